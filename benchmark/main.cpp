@@ -2,6 +2,7 @@
 
 import mo_yanxi.react_flow;
 import mo_yanxi.react_flow.common;
+import mo_yanxi.concurrent.mpsc_queue;
 import std;
 
 using namespace mo_yanxi::react_flow;
@@ -79,6 +80,39 @@ static void BM_Raw(benchmark::State& state) {
 	}
 }
 
+static void BM_StaticChain(benchmark::State& state) {
+    const std::vector<std::string> inputs = generate_random_strings(data_size);
+
+	manager manager;
+
+	auto& num_input = manager.add_node<provider_general<std::string>>();
+
+    // 与 BM_Node 相同的两个 transformer，融合为一个节点，中间不再经过虚调用与运行时类型检查
+	auto& chain = manager.add_node(make_static_chain(
+		make_transformer<descriptor<std::string, {true}, std::string_view>>([](std::string_view input) -> std::optional<int> {
+			int v;
+			if(const auto [ptr, ec] = std::from_chars(input.data(), input.data() + input.size(), v); ec == std::errc{}){
+				return v;
+			}
+
+			return std::nullopt;
+		}),
+		make_transformer([](std::optional<int>&& input) -> std::optional<int> {
+			return input.transform([](int val){return val * 2;});
+		})));
+
+	auto& listener = manager.add_node(make_listener([](std::optional<int> input){
+		benchmark::DoNotOptimize(input);
+	}));
+
+	connect_chain({&num_input, &chain, &listener});
+
+    std::size_t i = 0;
+	for (auto _ : state) {
+		num_input.update_value(inputs[i++ % data_size]);
+	}
+}
+
 
 #include <benchmark/benchmark.h>
 #include <vector>
@@ -204,8 +238,1059 @@ static void BM_ReactFlow_Pipeline(benchmark::State& state) {
 }
 BENCHMARK(BM_ReactFlow_Pipeline)->Range(1000, 100000);
 
-// 定义测试数据量范围：从 1024 到 1024*1024
-// BENCHMARK(BM_Node)->Range(1024, 64 * 1024);
-// BENCHMARK(BM_Raw)->Range(1024, 64 * 1024);
+// ============================================================================
+// 4. 菱形图 (Provider -> 4 分支 -> Join) 的传播方式对比
+// ============================================================================
+
+template <propagate_type JoinPropagate>
+static void BM_ReactFlow_WideDiamond(benchmark::State& state) {
+    using namespace mo_yanxi::react_flow;
+
+    std::uint32_t data_size = static_cast<std::uint32_t>(state.range(0));
+    std::vector<double> initial_data(data_size, 1.5);
+
+    manager mgr;
+
+    auto& provider = mgr.add_node<provider_cached<std::vector<double>>>();
+
+    auto& branch_norm = mgr.add_node(make_transformer(heavy_normalize));
+    auto& branch_ema  = mgr.add_node(make_transformer(heavy_ema));
+    auto& branch_macd = mgr.add_node(make_transformer(heavy_macd));
+    auto& branch_score = mgr.add_node(make_transformer(aggregate_score));
+
+    // eager 下 join 每条入边都会触发一次计算，并重新拉取其余未缓存的分支
+    auto& join = mgr.add_node(make_transformer(JoinPropagate, [](
+        const std::vector<double>& norm,
+        const std::vector<double>& ema,
+        const std::vector<double>& macd,
+        double score) {
+        return aggregate_score(norm) + aggregate_score(ema) + aggregate_score(macd) + score;
+    }));
+
+    double final_result = 0.0;
+    auto& listener = mgr.add_node(make_listener([&](double s) {
+        final_result = s;
+    }));
+
+    provider.connect_successor(branch_norm);
+    provider.connect_successor(branch_ema);
+    provider.connect_successor(branch_macd);
+    provider.connect_successor(branch_score);
+
+    join.connect_predecessor(0, branch_norm);
+    join.connect_predecessor(1, branch_ema);
+    join.connect_predecessor(2, branch_macd);
+    join.connect_predecessor(3, branch_score);
+    join.connect_successor(listener);
+
+    for (auto _ : state) {
+        provider.update_value(initial_data);
+
+        benchmark::DoNotOptimize(final_result);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_ReactFlow_WideDiamond<propagate_type::eager>)->Range(1000, 100000);
+BENCHMARK(BM_ReactFlow_WideDiamond<propagate_type::topological>)->Range(1000, 100000);
+
+// ============================================================================
+// 5. 建图开销 (每次连接都需要做环检测)
+// ============================================================================
+
+static void BM_GraphConstruction_Chain(benchmark::State& state) {
+    using namespace mo_yanxi::react_flow;
+
+    const auto node_count = static_cast<std::size_t>(state.range(0));
+
+    for (auto _ : state) {
+        manager mgr{manager_no_async};
+        std::vector<node*> nodes;
+        nodes.reserve(node_count);
+
+        for (std::size_t i = 0; i < node_count; ++i) {
+            nodes.push_back(&mgr.add_node(make_transformer([](int v){ return v + 1; })));
+        }
+
+        // 顺序追加，每条新边只抬升新加入的尾节点
+        for (std::size_t i = 1; i < node_count; ++i) {
+            nodes[i - 1]->connect_successor(*nodes[i]);
+        }
+
+        benchmark::DoNotOptimize(nodes.data());
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_GraphConstruction_Chain)->RangeMultiplier(4)->Range(1 << 8, 1 << 16)->Complexity();
+
+static void BM_GraphConstruction_ChainBackToFront(benchmark::State& state) {
+    using namespace mo_yanxi::react_flow;
+
+    const auto node_count = static_cast<std::size_t>(state.range(0));
+
+    for (auto _ : state) {
+        manager mgr{manager_no_async};
+        std::vector<node*> nodes;
+        nodes.reserve(node_count);
+
+        for (std::size_t i = 0; i < node_count; ++i) {
+            nodes.push_back(&mgr.add_node(make_transformer([](int v){ return v + 1; })));
+        }
+
+        // 逆序连接，每条新边都要抬升整条已连接的尾链 (rank 只升不降，整体 O(n^2))
+        for (std::size_t i = node_count - 1; i > 0; --i) {
+            nodes[i - 1]->connect_successor(*nodes[i]);
+        }
+
+        benchmark::DoNotOptimize(nodes.data());
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_GraphConstruction_ChainBackToFront)->RangeMultiplier(4)->Range(1 << 8, 1 << 14)->Complexity(benchmark::oNSquared);
+
+static void BM_GraphConstruction_Layered(benchmark::State& state) {
+    using namespace mo_yanxi::react_flow;
+
+    // 每层 8 个节点，相邻两层两两相连 (二输入 join)，边数与节点数同阶
+    constexpr std::size_t width = 8;
+    const auto layer_count = static_cast<std::size_t>(state.range(0)) / width;
+
+    for (auto _ : state) {
+        manager mgr{manager_no_async};
+        auto& source = mgr.add_node<provider_cached<int>>();
+
+        std::vector<node*> prev(width, &source);
+        std::vector<node*> cur;
+        cur.reserve(width);
+
+        for (std::size_t layer = 0; layer < layer_count; ++layer) {
+            cur.clear();
+            for (std::size_t i = 0; i < width; ++i) {
+                auto& join = mgr.add_node(make_transformer([](int a, int b){ return a + b; }));
+                join.connect_predecessor(0, *prev[i]);
+                join.connect_predecessor(1, *prev[(i + 1) % width]);
+                cur.push_back(&join);
+            }
+            std::swap(prev, cur);
+        }
+
+        benchmark::DoNotOptimize(prev.data());
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_GraphConstruction_Layered)->RangeMultiplier(4)->Range(1 << 8, 1 << 16)->Complexity();
+
+// ============================================================================
+// 6. 异步节点派发吞吐 (任务对象复用 vs 每次分配)
+// ============================================================================
+
+static void BM_AsyncDispatch(benchmark::State& state) {
+    using namespace mo_yanxi::react_flow;
+
+    constexpr std::size_t burst = 64;
+
+    manager mgr;
+    auto& provider = mgr.add_node<provider_cached<int>>();
+    auto& processor = mgr.add_node(make_async_transformer(propagate_type::eager, async_type::async_all, [](int v) {
+        return v + 1;
+    }));
+    processor.set_task_recycle_limit(static_cast<std::size_t>(state.range(0)));
+
+    std::size_t received = 0;
+    auto& listener = mgr.add_node(make_listener([&](int v) {
+        ++received;
+        benchmark::DoNotOptimize(v);
+    }));
+
+    provider.connect_successor(processor);
+    processor.connect_successor(listener);
+
+    for (auto _ : state) {
+        received = 0;
+        for (std::size_t i = 0; i < burst; ++i) {
+            provider.update_value(static_cast<int>(i));
+        }
+
+        while (received < burst) {
+            mgr.update();
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * burst));
+}
+// 参数为任务复用上限，0 即每次派发都分配新任务
+BENCHMARK(BM_AsyncDispatch)->Arg(0)->Arg(4)->Arg(64);
+
+// ============================================================================
+// 7. 并行扇出 (Provider -> 4 条互不相交的重负载分支)
+// ============================================================================
+
+template <bool Parallel>
+static void BM_ReactFlow_FanOut(benchmark::State& state) {
+    using namespace mo_yanxi::react_flow;
+
+    std::uint32_t data_size = static_cast<std::uint32_t>(state.range(0));
+    std::vector<double> initial_data(data_size, 1.5);
+
+    manager mgr{manager_no_async};
+
+    auto& provider = mgr.add_node<provider_cached<std::vector<double>>>();
+    provider.set_parallel_fan_out(Parallel);
+
+    std::array<double, 4> results{};
+    auto add_branch = [&](auto&& fn, std::size_t index) {
+        auto& branch = mgr.add_node(make_transformer(fn));
+        auto& score = mgr.add_node(make_transformer(aggregate_score));
+        auto& listener = mgr.add_node(make_listener([&results, index](double s) {
+            results[index] = s;
+        }));
+        provider.connect_successor(branch);
+        branch.connect_successor(score);
+        score.connect_successor(listener);
+    };
+
+    add_branch(heavy_normalize, 0);
+    add_branch(heavy_ema, 1);
+    add_branch(heavy_macd, 2);
+    add_branch(heavy_normalize, 3);
+
+    for (auto _ : state) {
+        provider.update_value(initial_data);
+
+        benchmark::DoNotOptimize(results);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_ReactFlow_FanOut<false>)->Range(1000, 100000);
+BENCHMARK(BM_ReactFlow_FanOut<true>)->Range(1000, 100000);
+
+// ============================================================================
+// 8. 大对象扇出 (深拷贝 vs shared_value 共享快照)
+// ============================================================================
+
+template <typename Payload>
+static void BM_ReactFlow_LargeFanOut(benchmark::State& state) {
+    using namespace mo_yanxi::react_flow;
+
+    std::uint32_t data_size = static_cast<std::uint32_t>(state.range(0));
+    const std::vector<double> initial_data(data_size, 1.5);
+
+    manager mgr{manager_no_async};
+
+    auto& provider = mgr.add_node<provider_general<Payload>>();
+
+    double sum = 0.0;
+    for (int i = 0; i < 4; ++i) {
+        auto& listener = mgr.add_node(make_listener([&](const Payload& v) {
+            if constexpr (std::same_as<Payload, std::vector<double>>) {
+                sum += v.back();
+            } else {
+                sum += v->back();
+            }
+        }));
+        provider.connect_successor(listener);
+    }
+
+    for (auto _ : state) {
+        provider.update_value(Payload{initial_data});
+
+        benchmark::DoNotOptimize(sum);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_ReactFlow_LargeFanOut<std::vector<double>>)->Range(1000, 100000);
+BENCHMARK(BM_ReactFlow_LargeFanOut<shared_value<std::vector<double>>>)->Range(1000, 100000);
+
+// ============================================================================
+// 9. 原地写入输出缓冲的流水线 (稳态无分配)
+// ============================================================================
+
+void heavy_normalize_into(std::vector<double>& res, const std::vector<double>& input) {
+    res.resize(input.size());
+    for (std::uint32_t i = 0; i < input.size(); ++i) {
+        res[i] = std::sin(input[i]) * 100.0 + std::cos(input[i] * 0.5);
+    }
+}
+
+void heavy_ema_into(std::vector<double>& res, const std::vector<double>& input) {
+    res.resize(input.size());
+    if (input.empty()) return;
+
+    double alpha = 0.2;
+    res[0] = input[0];
+    for (std::uint32_t i = 1; i < input.size(); ++i) {
+        res[i] = alpha * input[i] + (1.0 - alpha) * res[i - 1];
+    }
+}
+
+void heavy_macd_into(std::vector<double>& res, const std::vector<double>& input) {
+    res.resize(input.size());
+    for (std::uint32_t i = 0; i < input.size(); ++i) {
+        res[i] = std::tanh(input[i] * 0.01) * 50.0;
+    }
+}
+
+static void BM_ReactFlow_Pipeline_InPlace(benchmark::State& state) {
+    using namespace mo_yanxi::react_flow;
+
+    std::uint32_t data_size = static_cast<std::uint32_t>(state.range(0));
+    std::vector<double> initial_data(data_size, 1.5);
+
+    manager mgr;
+
+    auto& provider = mgr.add_node<provider_cached<std::vector<double>>>();
+
+    auto& node_norm = mgr.add_node(make_inplace_transformer(heavy_normalize_into));
+    auto& node_ema  = mgr.add_node(make_inplace_transformer(heavy_ema_into));
+    auto& node_macd = mgr.add_node(make_inplace_transformer(heavy_macd_into));
+    auto& node_agg = mgr.add_node(make_transformer(aggregate_score));
+
+    double final_result = 0.0;
+    auto& node_score = mgr.add_node(make_listener([&](double s) {
+        final_result = s;
+    }));
+
+    connect_chain({&provider, &node_norm, &node_ema, &node_macd, &node_agg, &node_score});
+
+    for (auto _ : state) {
+        provider.update_value(initial_data);
+
+        mgr.update();
+
+        benchmark::DoNotOptimize(final_result);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_ReactFlow_Pipeline_InPlace)->Range(1000, 100000);
+
+// ============================================================================
+// 10. 拓扑基准：宽扇出 (Provider -> N 个 listener)，与原生循环对比
+// ============================================================================
+
+static void BM_Native_WideFanOut(benchmark::State& state) {
+    const auto width = static_cast<std::size_t>(state.range(0));
+    std::vector<int> sinks(width);
+
+    int value = 0;
+    for (auto _ : state) {
+        ++value;
+        for (auto& sink : sinks) {
+            benchmark::DoNotOptimize(value);
+            sink = value + 1;
+        }
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_Native_WideFanOut)->RangeMultiplier(8)->Range(8, 4096);
+
+static void BM_ReactFlow_WideFanOut(benchmark::State& state) {
+    using namespace mo_yanxi::react_flow;
+
+    const auto width = static_cast<std::size_t>(state.range(0));
+    std::vector<int> sinks(width);
+
+    manager mgr{manager_no_async};
+    auto& provider = mgr.add_node<provider_cached<int>>();
+    for (std::size_t i = 0; i < width; ++i) {
+        auto& listener = mgr.add_node(make_listener([&sinks, i](int v) {
+            sinks[i] = v + 1;
+        }));
+        provider.connect_successor(listener);
+    }
+
+    int value = 0;
+    for (auto _ : state) {
+        provider.update_value(++value);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_ReactFlow_WideFanOut)->RangeMultiplier(8)->Range(8, 4096);
+
+// ============================================================================
+// 11. 拓扑基准：多输入汇合 (4 个 Provider -> Join)，每轮更新全部输入
+// ============================================================================
+
+static void BM_Native_FanIn(benchmark::State& state) {
+    std::array<int, 4> inputs{};
+
+    int value = 0;
+    for (auto _ : state) {
+        ++value;
+        for (auto& input : inputs) {
+            input = value;
+            benchmark::DoNotOptimize(input);
+        }
+        int sum = inputs[0] + inputs[1] + inputs[2] + inputs[3];
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_Native_FanIn);
+
+// Batched = true 时在事务中更新全部输入，join 只计算一次；否则每个输入各触发一次
+template <bool Batched>
+static void BM_ReactFlow_FanIn(benchmark::State& state) {
+    using namespace mo_yanxi::react_flow;
+
+    manager mgr{manager_no_async};
+
+    std::array<provider_cached<int>*, 4> inputs{};
+    for (auto& input : inputs) {
+        input = &mgr.add_node<provider_cached<int>>();
+    }
+
+    auto& join = mgr.add_node(make_transformer([](int a, int b, int c, int d) {
+        return a + b + c + d;
+    }));
+    for (std::size_t i = 0; i < inputs.size(); ++i) {
+        join.connect_predecessor(i, *inputs[i]);
+    }
+
+    int sum = 0;
+    auto& listener = mgr.add_node(make_listener([&](int v) {
+        sum = v;
+    }));
+    join.connect_successor(listener);
+
+    int value = 0;
+    for (auto _ : state) {
+        ++value;
+        if constexpr (Batched) {
+            mgr.batch([&] {
+                for (auto* input : inputs) input->update_value(value);
+            });
+        } else {
+            for (auto* input : inputs) input->update_value(value);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_ReactFlow_FanIn<false>);
+BENCHMARK(BM_ReactFlow_FanIn<true>);
+
+// ============================================================================
+// 12. 拓扑基准：串联菱形 (x -> {x + 1, x * 2} -> join) 重复 N 层
+// ============================================================================
+
+static void BM_Native_DiamondChain(benchmark::State& state) {
+    const auto depth = static_cast<std::size_t>(state.range(0));
+
+    int value = 0;
+    for (auto _ : state) {
+        int x = ++value;
+        for (std::size_t i = 0; i < depth; ++i) {
+            benchmark::DoNotOptimize(x);
+            x = ((x + 1) + (x * 2)) & 0xffff;
+        }
+        benchmark::DoNotOptimize(x);
+    }
+}
+BENCHMARK(BM_Native_DiamondChain)->RangeMultiplier(4)->Range(4, 256);
+
+// eager 下每层 join 各被推送两次，层数增加时重复计算呈指数增长；topological 下每个节点每轮只计算一次
+template <propagate_type Propagate>
+static void BM_ReactFlow_DiamondChain(benchmark::State& state) {
+    using namespace mo_yanxi::react_flow;
+
+    const auto depth = static_cast<std::size_t>(state.range(0));
+
+    manager mgr{manager_no_async};
+    auto& provider = mgr.add_node<provider_cached<int>>();
+
+    node* prev = &provider;
+    for (std::size_t i = 0; i < depth; ++i) {
+        auto& lhs = mgr.add_node(make_transformer(Propagate, [](int x) { return x + 1; }));
+        auto& rhs = mgr.add_node(make_transformer(Propagate, [](int x) { return x * 2; }));
+        auto& join = mgr.add_node(make_transformer(Propagate, [](int a, int b) { return (a + b) & 0xffff; }));
+        prev->connect_successor(lhs);
+        prev->connect_successor(rhs);
+        join.connect_predecessor(0, lhs);
+        join.connect_predecessor(1, rhs);
+        prev = &join;
+    }
+
+    int result = 0;
+    auto& listener = mgr.add_node(make_listener([&](int v) {
+        result = v;
+    }));
+    prev->connect_successor(listener);
+
+    int value = 0;
+    for (auto _ : state) {
+        provider.update_value(++value);
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK(BM_ReactFlow_DiamondChain<propagate_type::eager>)->RangeMultiplier(4)->Range(4, 16);
+BENCHMARK(BM_ReactFlow_DiamondChain<propagate_type::topological>)->RangeMultiplier(4)->Range(4, 256);
+
+// ============================================================================
+// 13. 拓扑基准：同一条链在 eager / lazy / pulse / topological 下的传播开销 (含万级深链)
+// ============================================================================
+
+static void BM_Native_Chain(benchmark::State& state) {
+    const auto depth = static_cast<std::size_t>(state.range(0));
+
+    int value = 0;
+    for (auto _ : state) {
+        int x = ++value;
+        for (std::size_t i = 0; i < depth; ++i) {
+            benchmark::DoNotOptimize(x);
+            x = x + 1;
+        }
+        benchmark::DoNotOptimize(x);
+    }
+}
+BENCHMARK(BM_Native_Chain)->RangeMultiplier(10)->Range(10, 10000);
+
+// lazy 由终端 request_cache 拉取，pulse 由 manager::update 驱动
+template <propagate_type Propagate>
+static void BM_ReactFlow_Chain(benchmark::State& state) {
+    using namespace mo_yanxi::react_flow;
+
+    const auto depth = static_cast<std::size_t>(state.range(0));
+
+    manager mgr{manager_no_async};
+    auto& provider = mgr.add_node<provider_cached<int>>();
+
+    node* prev = &provider;
+    for (std::size_t i = 0; i < depth; ++i) {
+        auto& next = mgr.add_node(make_transformer(Propagate, [](int x) { return x + 1; }));
+        prev->connect_successor(next);
+        prev = &next;
+    }
+
+    auto& terminal = mgr.add_node<terminal_cached<int>>(Propagate);
+    prev->connect_successor(terminal);
+
+    int value = 0;
+    for (auto _ : state) {
+        provider.update_value(++value);
+        if constexpr (Propagate == propagate_type::pulse) {
+            mgr.update();
+        }
+        benchmark::DoNotOptimize(terminal.request_cache());
+    }
+    state.SetComplexityN(state.range(0));
+}
+// eager 推送与 lazy 拉取都沿链递归，深度受调用栈限制，万级深链只测非递归的 pulse / topological
+BENCHMARK(BM_ReactFlow_Chain<propagate_type::eager>)->RangeMultiplier(10)->Range(10, 1000)->Complexity();
+BENCHMARK(BM_ReactFlow_Chain<propagate_type::lazy>)->RangeMultiplier(10)->Range(10, 1000)->Complexity();
+BENCHMARK(BM_ReactFlow_Chain<propagate_type::pulse>)->RangeMultiplier(10)->Range(10, 10000)->Complexity();
+BENCHMARK(BM_ReactFlow_Chain<propagate_type::topological>)->RangeMultiplier(10)->Range(10, 10000)->Complexity();
+
+// ============================================================================
+// 14. terminal_cached 轮询 (缓存命中 vs 上游变更后重新拉取)
+// ============================================================================
+
+static void BM_Native_Polling(benchmark::State& state) {
+    int cache = 42;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(cache);
+    }
+}
+BENCHMARK(BM_Native_Polling);
+
+template <bool Dirty>
+static void BM_ReactFlow_TerminalPolling(benchmark::State& state) {
+    using namespace mo_yanxi::react_flow;
+
+    manager mgr{manager_no_async};
+    auto& provider = mgr.add_node<provider_cached<int>>();
+    auto& trans = mgr.add_node(make_transformer(propagate_type::lazy, [](int x) { return x * 2; }));
+    auto& terminal = mgr.add_node<terminal_cached<int>>(propagate_type::lazy);
+    connect_chain({&provider, &trans, &terminal});
+
+    provider.update_value(21);
+
+    int value = 0;
+    for (auto _ : state) {
+        if constexpr (Dirty) {
+            provider.update_value(++value);
+        }
+        benchmark::DoNotOptimize(terminal.request_cache());
+    }
+}
+BENCHMARK(BM_ReactFlow_TerminalPolling<false>);
+BENCHMARK(BM_ReactFlow_TerminalPolling<true>);
+
+// ============================================================================
+// 15. 建图与拆图 (connect_successor -> disconnect_self_from_context -> clear_isolated)
+// ============================================================================
+
+static void BM_Native_GraphLifecycle(benchmark::State& state) {
+    const auto node_count = static_cast<std::size_t>(state.range(0));
+
+    for (auto _ : state) {
+        std::vector<std::unique_ptr<std::function<int(int)>>> nodes;
+        std::vector<std::vector<std::size_t>> successors(node_count);
+        nodes.reserve(node_count);
+
+        for (std::size_t i = 0; i < node_count; ++i) {
+            nodes.push_back(std::make_unique<std::function<int(int)>>([](int v) { return v + 1; }));
+        }
+        for (std::size_t i = 1; i < node_count; ++i) {
+            successors[i - 1].push_back(i);
+        }
+
+        benchmark::DoNotOptimize(nodes.data());
+        benchmark::DoNotOptimize(successors.data());
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_Native_GraphLifecycle)->RangeMultiplier(4)->Range(1 << 6, 1 << 12)->Complexity();
+
+static void BM_ReactFlow_GraphLifecycle(benchmark::State& state) {
+    using namespace mo_yanxi::react_flow;
+
+    const auto node_count = static_cast<std::size_t>(state.range(0));
+    manager mgr{manager_no_async};
+    std::vector<node*> nodes;
+    nodes.reserve(node_count);
+
+    for (auto _ : state) {
+        nodes.clear();
+        for (std::size_t i = 0; i < node_count; ++i) {
+            nodes.push_back(&mgr.add_node(make_transformer([](int v) { return v + 1; })));
+        }
+        for (std::size_t i = 1; i < node_count; ++i) {
+            nodes[i - 1]->connect_successor(*nodes[i]);
+        }
+
+        for (auto* n : nodes) {
+            n->disconnect_self_from_context();
+        }
+        mgr.clear_isolated();
+        mgr.update();
+
+        benchmark::ClobberMemory();
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_ReactFlow_GraphLifecycle)->RangeMultiplier(4)->Range(1 << 6, 1 << 12)->Complexity();
+
+// ============================================================================
+// 16. 跨线程写入 provider (push_posted_act 逐次投递 vs provider_concurrent 最新值槽)
+// ============================================================================
+
+// 每轮由另一线程写入 1024 次，再由主线程 update 一次，按写入次数统计吞吐
+template <bool Concurrent>
+static void BM_CrossThreadProvider(benchmark::State& state) {
+    using namespace mo_yanxi::react_flow;
+
+    manager mgr{manager_no_async};
+    auto& cached = mgr.add_node<provider_cached<int>>();
+    auto& concurrent = mgr.add_node<provider_concurrent<int>>();
+
+    int last = 0;
+    auto& listener = mgr.add_node(make_listener([&](int v) {
+        last = v;
+    }));
+    if constexpr (Concurrent) {
+        concurrent.connect_successor(listener);
+    } else {
+        cached.connect_successor(listener);
+    }
+
+    constexpr int updates_per_round = 1024;
+    for (auto _ : state) {
+        std::jthread{[&] {
+            for (int i = 0; i < updates_per_round; ++i) {
+                if constexpr (Concurrent) {
+                    concurrent.post_value(i);
+                } else {
+                    mgr.push_posted_act([&cached, i] {
+                        cached.update_value(i);
+                    });
+                }
+            }
+        }}.join();
+
+        mgr.update();
+        benchmark::DoNotOptimize(last);
+    }
+    state.SetItemsProcessed(state.iterations() * updates_per_round);
+}
+BENCHMARK(BM_CrossThreadProvider<false>);
+BENCHMARK(BM_CrossThreadProvider<true>);
+
+// ============================================================================
+// 17. 跨线程投递 (原 mpsc_queue<move_only_function> vs 内联槽位环形队列)，N 个生产者线程
+// ============================================================================
+
+template <bool Ring>
+static void BM_PostedActs(benchmark::State& state) {
+    using namespace mo_yanxi::react_flow;
+
+    const auto producer_count = static_cast<int>(state.range(0));
+    constexpr int acts_per_producer = 4096;
+
+    manager mgr{manager_no_async};
+    using legacy_queue = mo_yanxi::ccur::mpsc_queue<std::move_only_function<void()>>;
+    legacy_queue queue;
+    legacy_queue::container_type drained;
+
+    std::uint64_t sum = 0;
+    for (auto _ : state) {
+        std::atomic<int> running = producer_count;
+        std::vector<std::jthread> producers;
+        for (int t = 0; t < producer_count; ++t) {
+            producers.emplace_back([&] {
+                for (int i = 0; i < acts_per_producer; ++i) {
+                    // 捕获 40 字节，超出 move_only_function 的小对象缓冲，但仍可内联存入环形队列槽位
+                    auto act = [&sum, v = std::array<std::uint64_t, 4>{std::uint64_t(i), 1, 2, 3}] {
+                        sum += v[0] + v[1] + v[2] + v[3];
+                    };
+                    if constexpr (Ring) {
+                        mgr.push_posted_act(act);
+                    } else {
+                        queue.emplace(act);
+                    }
+                }
+                running.fetch_sub(1);
+            });
+        }
+
+        // 主线程边生产边消费
+        do {
+            if constexpr (Ring) {
+                mgr.update();
+            } else {
+                if (queue.swap(drained)) {
+                    for (auto& fn : drained) fn();
+                    drained.clear();
+                }
+            }
+        } while (running.load() != 0);
+        producers.clear();
+
+        if constexpr (Ring) {
+            mgr.update();
+        } else if (queue.swap(drained)) {
+            for (auto& fn : drained) fn();
+            drained.clear();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * producer_count * acts_per_producer);
+}
+BENCHMARK(BM_PostedActs<false>)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+BENCHMARK(BM_PostedActs<true>)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+
+// ============================================================================
+// 18. 脉冲 tick 开销 (N 个 pulse 节点，每轮只有一个有待触发数据)
+// ============================================================================
+
+static void BM_PulseTick_SparsePending(benchmark::State& state) {
+    using namespace mo_yanxi::react_flow;
+
+    const auto node_count = static_cast<std::size_t>(state.range(0));
+
+    manager mgr{manager_no_async};
+    std::vector<provider_cached<int>*> sources;
+    sources.reserve(node_count);
+
+    int sum = 0;
+    for (std::size_t i = 0; i < node_count; ++i) {
+        auto& source = mgr.add_node<provider_cached<int>>(propagate_type::pulse);
+        auto& listener = mgr.add_node(make_listener([&](int v) {
+            sum += v;
+        }));
+        source.connect_successor(listener);
+        sources.push_back(&source);
+    }
+
+    std::size_t i = 0;
+    for (auto _ : state) {
+        sources[i++ % node_count]->update_value(1);
+        mgr.update();
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetComplexityN(state.range(0));
+}
+// tick 只访问有待触发数据的节点，耗时应与 N 无关
+BENCHMARK(BM_PulseTick_SparsePending)->RangeMultiplier(8)->Range(8, 1 << 15)->Complexity();
+
+// ============================================================================
+// 19. 节点增删抖动 (常驻 N 个节点，每帧创建并删除 64 个节点的子图)
+// ============================================================================
+
+static void BM_NodeChurn(benchmark::State& state) {
+    using namespace mo_yanxi::react_flow;
+
+    const auto resident_count = static_cast<std::size_t>(state.range(0));
+    constexpr std::size_t churn_count = 64;
+
+    manager mgr{manager_no_async};
+    for (std::size_t i = 0; i < resident_count; ++i) {
+        (void)mgr.add_node(make_transformer([](int v) { return v + 1; }));
+    }
+
+    std::vector<node*> frame_nodes;
+    frame_nodes.reserve(churn_count);
+    for (auto _ : state) {
+        frame_nodes.clear();
+        for (std::size_t i = 0; i < churn_count; ++i) {
+            frame_nodes.push_back(&mgr.add_node(make_transformer([](int v) { return v + 1; })));
+        }
+        for (std::size_t i = 1; i < churn_count; ++i) {
+            frame_nodes[i - 1]->connect_successor(*frame_nodes[i]);
+        }
+
+        for (auto* n : frame_nodes) {
+            n->disconnect_self_from_context();
+            mgr.erase_node(*n);
+        }
+        mgr.update();
+    }
+    state.SetComplexityN(state.range(0));
+}
+// 移除为 O(1)，每帧耗时应与常驻节点数无关
+BENCHMARK(BM_NodeChurn)->RangeMultiplier(8)->Range(64, 1 << 18)->Complexity();
+
+// ============================================================================
+// 20. 并发 I/O 型任务 (N 个任务各等待 2ms，2 个工作线程：阻塞 async_node vs 协程节点)
+// ============================================================================
+
+template <bool Coroutine>
+static void BM_ConcurrentWaits(benchmark::State& state) {
+    using namespace mo_yanxi::react_flow;
+
+    const auto task_count = static_cast<int>(state.range(0));
+    constexpr auto wait = std::chrono::milliseconds(2);
+
+    manager mgr{manager_config{.async_worker_count = 2}};
+    auto& source = mgr.add_node<provider_cached<int>>();
+
+    node* processor;
+    if constexpr (Coroutine) {
+        processor = &mgr.add_node(make_coro_transformer(propagate_type::eager, async_type::async_all,
+            [wait](coro_context ctx, int v) -> coro_task<int> {
+                co_await ctx.sleep_for(wait);
+                co_return v;
+            }));
+    } else {
+        // 阻塞等待期间占用工作线程
+        processor = &mgr.add_node(make_async_transformer(propagate_type::eager, async_type::async_all,
+            [wait](int v) {
+                std::this_thread::sleep_for(wait);
+                return v;
+            }));
+    }
+
+    int finished = 0;
+    auto& listener = mgr.add_node(make_listener([&](int) { ++finished; }));
+    source.connect_successor(*processor);
+    processor->connect_successor(listener);
+
+    for (auto _ : state) {
+        finished = 0;
+        for (int i = 0; i < task_count; ++i) {
+            source.update_value(i);
+        }
+        while (finished < task_count) {
+            mgr.update();
+            std::this_thread::yield();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * task_count);
+}
+// 阻塞版本耗时随 N / 工作线程数增长，协程版本约为单次等待时间
+BENCHMARK(BM_ConcurrentWaits<false>)->RangeMultiplier(4)->Range(4, 64)->UseRealTime();
+BENCHMARK(BM_ConcurrentWaits<true>)->RangeMultiplier(4)->Range(4, 64)->UseRealTime();
+
+// ============================================================================
+// 21. 异步往返延迟 (sleep 1ms 轮询 update vs wait_and_update 阻塞等待唤醒)
+// ============================================================================
+
+template <bool Wait>
+static void BM_AsyncRoundTrip(benchmark::State& state) {
+    using namespace mo_yanxi::react_flow;
+
+    manager mgr;
+    auto& source = mgr.add_node<provider_cached<int>>();
+    auto& async = mgr.add_node(make_async_transformer([](int v) { return v + 1; }));
+    int received = 0;
+    auto& listener = mgr.add_node(make_listener([&](int v) { received = v; }));
+    source.connect_successor(async);
+    async.connect_successor(listener);
+
+    int i = 0;
+    for (auto _ : state) {
+        source.update_value(++i);
+        while (received != i + 1) {
+            if constexpr (Wait) {
+                mgr.wait_and_update(std::chrono::seconds(1));
+            } else {
+                mgr.update();
+                if (received != i + 1) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+    }
+}
+// 轮询版本的延迟由睡眠间隔决定，阻塞等待版本在工作线程完成后立即被唤醒
+BENCHMARK(BM_AsyncRoundTrip<false>)->UseRealTime();
+BENCHMARK(BM_AsyncRoundTrip<true>)->UseRealTime();
+
+// ============================================================================
+// 22. 批量传播 (N 个 float 逐个 update_value vs 一次推送 value_batch，两级逐元素变换)
+// ============================================================================
+
+static void BM_Native_Elementwise(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    std::vector<float> input(count, 1.5f);
+    std::vector<float> output(count);
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < count; ++i) {
+            output[i] = input[i] * 2.f + 1.f;
+        }
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_Native_Elementwise)->RangeMultiplier(8)->Range(64, 1 << 15);
+
+template <bool Batched>
+static void BM_ReactFlow_Elementwise(benchmark::State& state) {
+    using namespace mo_yanxi::react_flow;
+
+    const auto count = static_cast<std::size_t>(state.range(0));
+    manager mgr{manager_no_async};
+
+    float sink = 0;
+    if constexpr (Batched) {
+        auto& source = mgr.add_node<provider_general<value_batch<float>>>();
+        auto& mul = mgr.add_node(make_batch_transformer([](float v) { return v * 2.f; }));
+        auto& add = mgr.add_node(make_batch_transformer([](float v) { return v + 1.f; }));
+        auto& listener = mgr.add_node(make_batch_listener([&](std::span<const float> values) {
+            sink += values.back();
+        }));
+        connect_chain({&source, &mul, &add, &listener});
+
+        const value_batch<float> input{std::vector<float>(count, 1.5f)};
+        for (auto _ : state) {
+            source.update_value(input);
+            benchmark::DoNotOptimize(sink);
+        }
+    } else {
+        auto& source = mgr.add_node<provider_general<float>>();
+        auto& mul = mgr.add_node(make_transformer([](float v) { return v * 2.f; }));
+        auto& add = mgr.add_node(make_transformer([](float v) { return v + 1.f; }));
+        auto& listener = mgr.add_node(make_listener([&](float v) { sink += v; }));
+        connect_chain({&source, &mul, &add, &listener});
+
+        for (auto _ : state) {
+            for (std::size_t i = 0; i < count; ++i) {
+                source.update_value(1.5f);
+            }
+            benchmark::DoNotOptimize(sink);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+// 逐个推送的单元素开销为整条链的调度开销，批量推送摊薄到接近原生循环
+BENCHMARK(BM_ReactFlow_Elementwise<false>)->RangeMultiplier(8)->Range(64, 1 << 15);
+BENCHMARK(BM_ReactFlow_Elementwise<true>)->RangeMultiplier(8)->Range(64, 1 << 15);
+
+// ============================================================================
+// 23. 增量序列传播 (历史长度 N，每帧追加 16 个样本：整段 vector 重算 vs series_delta 只处理新增尾部)
+// ============================================================================
+
+template <bool Incremental>
+static void BM_ReactFlow_SeriesAppend(benchmark::State& state) {
+    using namespace mo_yanxi::react_flow;
+
+    constexpr std::size_t append_count = 16;
+    const auto history = static_cast<std::size_t>(state.range(0));
+    manager mgr{manager_no_async};
+
+    double final_result = 0.0;
+    auto& listener = mgr.add_node(make_listener([&](double s) { final_result = s; }));
+
+    if constexpr (Incremental) {
+        auto& source = mgr.add_node<series_source<double>>();
+        auto& norm = mgr.add_node(make_series_map([](double v) {
+            return std::sin(v) * 100.0 + std::cos(v * 0.5);
+        }));
+        auto& ema = mgr.add_node(make_series_ema(0.2));
+        auto& macd = mgr.add_node(make_series_map([](double v) { return std::tanh(v * 0.01) * 50.0; }));
+        auto& score = mgr.add_node(make_series_reduce(0.0, [](double acc, double v) { return acc + v; }));
+        connect_chain({&source, &norm, &ema, &macd, &score, &listener});
+
+        source.append(std::vector<double>(history, 1.5));
+        const std::vector<double> tail(append_count, 1.5);
+        for (auto _ : state) {
+            source.append(tail);
+            benchmark::DoNotOptimize(final_result);
+        }
+    } else {
+        auto& source = mgr.add_node<provider_cached<std::vector<double>>>();
+        auto& norm = mgr.add_node(make_transformer(heavy_normalize));
+        auto& ema = mgr.add_node(make_transformer(heavy_ema));
+        auto& macd = mgr.add_node(make_transformer(heavy_macd));
+        auto& score = mgr.add_node(make_transformer(aggregate_score));
+        connect_chain({&source, &norm, &ema, &macd, &score, &listener});
+
+        // 历史长度固定为 N，等价于每帧追加后整段重算
+        const std::vector<double> input(history, 1.5);
+        for (auto _ : state) {
+            source.update_value(input);
+            benchmark::DoNotOptimize(final_result);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * append_count);
+}
+// 整段重算随历史长度线性增长，增量版本只与每帧新增样本数相关
+BENCHMARK(BM_ReactFlow_SeriesAppend<false>)->RangeMultiplier(8)->Range(1024, 1 << 17);
+BENCHMARK(BM_ReactFlow_SeriesAppend<true>)->RangeMultiplier(8)->Range(1024, 1 << 17);
+
+// ============================================================================
+// 24. 差量补丁传播 (N 个元素的 vector 每帧只改一个元素：整值重算 vs value_patch 只重算改动元素)
+// ============================================================================
+
+template <bool Patched>
+static void BM_ReactFlow_SingleElementChange(benchmark::State& state) {
+    using namespace mo_yanxi::react_flow;
+
+    const auto count = static_cast<std::size_t>(state.range(0));
+    manager mgr{manager_no_async};
+
+    double sink = 0;
+    std::size_t index = 0;
+    if constexpr (Patched) {
+        auto& source = mgr.add_node<patch_source<std::vector<double>>>();
+        auto& norm = mgr.add_node(make_patch_map<std::vector<double>>([](double v) {
+            return std::sin(v) * 100.0 + std::cos(v * 0.5);
+        }));
+        auto& listener = mgr.add_node(make_listener([&](const value_patch<std::vector<double>>& v) {
+            sink += v.value.back();
+        }));
+        connect_chain({&source, &norm, &listener});
+
+        source.assign(std::vector<double>(count, 1.5));
+        for (auto _ : state) {
+            source.set(index, static_cast<double>(index));
+            index = (index + 1) % count;
+            benchmark::DoNotOptimize(sink);
+        }
+    } else {
+        auto& source = mgr.add_node<provider_cached<std::vector<double>>>();
+        auto& norm = mgr.add_node(make_transformer(heavy_normalize));
+        auto& listener = mgr.add_node(make_listener([&](const std::vector<double>& v) { sink += v.back(); }));
+        connect_chain({&source, &norm, &listener});
+
+        source.update_value(std::vector<double>(count, 1.5));
+        for (auto _ : state) {
+            source.update_value([&](std::vector<double>& v) -> double& { return v[index]; }, static_cast<double>(index));
+            index = (index + 1) % count;
+            benchmark::DoNotOptimize(sink);
+        }
+    }
+}
+// 整值传播每帧都是 O(N) 的重算与拷贝，补丁传播只处理改动的元素
+BENCHMARK(BM_ReactFlow_SingleElementChange<false>)->RangeMultiplier(8)->Range(1024, 1 << 17);
+BENCHMARK(BM_ReactFlow_SingleElementChange<true>)->RangeMultiplier(8)->Range(1024, 1 << 17);
+
+BENCHMARK(BM_Node);
+BENCHMARK(BM_StaticChain);
+BENCHMARK(BM_Raw);
 
 BENCHMARK_MAIN();
\ No newline at end of file
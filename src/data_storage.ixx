@@ -51,6 +51,26 @@ namespace mo_yanxi::react_flow{
 		def = async_latest
 	};
 
+	/**
+	 * @brief What an async node does with arguments arriving while its in-flight limit is reached and its queue is full
+	 */
+	export enum struct backpressure_policy : std::uint8_t{
+		/**
+		 * @brief Discard the arriving arguments
+		 */
+		drop_newest,
+
+		/**
+		 * @brief Discard the oldest queued arguments to make room for the arriving ones
+		 */
+		drop_oldest,
+
+		/**
+		 * @brief Keep a single queued entry, the arriving arguments replace it and are dispatched when a task finishes
+		 */
+		coalesce,
+	};
+
 	export enum struct trigger_type : std::uint8_t{
 
 		/**
@@ -83,7 +103,15 @@ namespace mo_yanxi::react_flow{
 		/**
 		 * @brief Updates are synchronized with a "pulse" signal (e.g., a clock tick).
 		 */
-		pulse
+		pulse,
+
+		/**
+		 * @brief Pushed inputs are staged, the node is evaluated once per propagation in topological (rank) order.
+		 *
+		 * Avoids redundant and glitched (mixed old/new inputs) evaluation on diamond shaped graphs.
+		 * Behaves as eager on providers and terminals.
+		 */
+		topological
 	};
 
 	export enum struct data_pending_state : std::uint8_t{
@@ -526,6 +554,100 @@ namespace mo_yanxi::react_flow{
 		T value_;
 	};
 
+	/**
+	 * @brief Refcounted immutable payload, copying it (e.g. on fan-out) only shares the snapshot.
+	 *
+	 * Use it as the data type of large values to opt in to zero-copy fan-out.
+	 * A consumer copies the value only when it mutates a snapshot shared with others (copy-on-write).
+	 */
+	export
+	template <typename T>
+	class shared_value{
+		static_assert(std::is_object_v<T> && !std::is_const_v<T>);
+
+	public:
+		using value_type = T;
+
+	private:
+		std::shared_ptr<T> ptr_{};
+
+	public:
+		[[nodiscard]] shared_value() = default;
+
+		[[nodiscard]] explicit(false) shared_value(T&& value) : ptr_(std::make_shared<T>(std::move(value))){
+		}
+
+		[[nodiscard]] explicit(false) shared_value(const T& value) : ptr_(std::make_shared<T>(value)){
+		}
+
+		template <typename... Args>
+			requires (std::constructible_from<T, Args&&...>)
+		[[nodiscard]] explicit shared_value(std::in_place_t, Args&&... args) : ptr_(std::make_shared<T>(std::forward<Args>(args)...)){
+		}
+
+		[[nodiscard]] bool has_value() const noexcept{
+			return ptr_ != nullptr;
+		}
+
+		explicit operator bool() const noexcept{
+			return has_value();
+		}
+
+		[[nodiscard]] const T& get() const noexcept{
+			assert(ptr_);
+			return *ptr_;
+		}
+
+		const T& operator*() const noexcept{
+			return get();
+		}
+
+		const T* operator->() const noexcept{
+			return std::addressof(get());
+		}
+
+		/**
+		 * @brief Whether no other snapshot shares the value, i.e. mutation requires no copy
+		 */
+		[[nodiscard]] bool is_unique() const noexcept{
+			return ptr_.use_count() == 1;
+		}
+
+		[[nodiscard]] long use_count() const noexcept{
+			return ptr_.use_count();
+		}
+
+		/**
+		 * @brief Mutable access, a private copy is detached first if the snapshot is shared
+		 */
+		[[nodiscard]] T& mutate() requires (std::is_copy_constructible_v<T>){
+			assert(ptr_);
+			if(!is_unique()){
+				ptr_ = std::make_shared<T>(std::as_const(*ptr_));
+			}
+			return *ptr_;
+		}
+
+		/**
+		 * @brief Take the value out, moves if unique and copies otherwise
+		 */
+		[[nodiscard]] T take() && requires (std::is_copy_constructible_v<T>){
+			assert(ptr_);
+			auto ptr = std::move(ptr_);
+			if(ptr.use_count() == 1){
+				return std::move(*ptr);
+			}
+			return *ptr;
+		}
+
+		friend bool operator==(const shared_value& lhs, const shared_value& rhs) noexcept(noexcept(*lhs.ptr_ == *rhs.ptr_))
+			requires (std::equality_comparable<T>){
+			if(lhs.ptr_ == rhs.ptr_) return true;
+			if(!lhs.ptr_ || !rhs.ptr_) return false;
+			return *lhs.ptr_ == *rhs.ptr_;
+		}
+	};
+
 	export
 	template <typename T>
 	using data_pass_t =
@@ -675,6 +797,77 @@ namespace mo_yanxi::react_flow{
 		 * @brief disallow expired on fetch request
 		 */
 		bool fresh;
+
+		/**
+		 * @brief (return descriptor) stop propagation when the output equals the previous one, see distinct_record
+		 */
+		bool distinct;
+	};
+
+	/**
+	 * @brief Specialize with `std::size_t operator()(const T&) const` to compare large types by hash on distinct checks.
+	 *
+	 * Equal hashes are treated as unchanged, a collision therefore drops an update.
+	 */
+	export
+	template <typename T>
+	struct distinct_hash;
+
+	template <typename T>
+	concept user_distinct_hashable = requires(const T& v){
+		{ distinct_hash<T>{}(v) } -> std::convertible_to<std::size_t>;
+	};
+
+	export
+	template <typename T, bool cached>
+	concept distinct_comparable = user_distinct_hashable<T> || (std::equality_comparable<T> && (cached || std::copy_constructible<T>));
+
+	/**
+	 * @brief Record of the last pushed value for change detection.
+	 *
+	 * Compares by distinct_hash if it is specialized, otherwise by value against the cache.
+	 * Without a cache, a private copy of the last value is kept.
+	 */
+	export
+	template <typename T, bool cached>
+	struct distinct_record{
+	private:
+		static constexpr bool by_user_hash = user_distinct_hashable<T>;
+		static constexpr bool by_cache = !by_user_hash && cached;
+
+		using record_type = std::conditional_t<by_user_hash, std::size_t, std::conditional_t<by_cache, std::monostate, T>>;
+
+		std::optional<record_type> last_{};
+
+	public:
+		/**
+		 * @param cache the value last pushed, only used when cached
+		 * @return false if value equals the last recorded one, otherwise record it and return true
+		 */
+		constexpr bool check_changed(const T& value, const T* cache){
+			if constexpr(by_user_hash){
+				const std::size_t hash = distinct_hash<T>{}(value);
+				if(last_ && *last_ == hash) return false;
+				last_ = hash;
+				return true;
+			} else if constexpr(by_cache){
+				assert(cache != nullptr);
+				if(last_ && *cache == value) return false;
+				last_.emplace();
+				return true;
+			} else{
+				if(last_ && *last_ == value) return false;
+				last_ = value;
+				return true;
+			}
+		}
+
+		/**
+		 * @brief Forget the record, the next check always reports a change
+		 */
+		constexpr void reset() noexcept{
+			last_.reset();
+		}
 	};
 
 	export
@@ -703,6 +896,11 @@ namespace mo_yanxi::react_flow{
 			return std::addressof(input.get_ref_view());
 		}
 
+		//copy-on-write unwrap, only copies when the snapshot is still shared with others
+		FORCE_INLINE static D operator()(data_carrier<S>&& input) requires (spec_of<S, shared_value> && std::same_as<typename S::value_type, D>){
+			return input.get().take();
+		}
+
 		FORCE_INLINE static data_carrier<D>&& operator()(data_carrier<S>&& input) noexcept requires (std::same_as<S, D>){
 			return std::move(input);
 		}
@@ -724,9 +922,12 @@ namespace mo_yanxi::react_flow{
 		static_assert(std::convertible_to<std::invoke_result_t<convertor_type, data_carrier<input_type>&&>, data_carrier<output_type>>);
 		static_assert(std::is_object_v<InputType>);
 
+		static_assert(!tag.distinct || distinct_comparable<InputType, tag.cache>, "distinct requires equality comparable or distinct_hash specialized type");
+
 	private:
 		ADAPTED_NO_UNIQUE_ADDRESS optional_val<input_type, tag.cache> value;
 		ADAPTED_NO_UNIQUE_ADDRESS convertor_type transformer;
+		ADAPTED_NO_UNIQUE_ADDRESS optional_val<distinct_record<input_type, tag.cache>, tag.distinct> last_output_;
 
 	public:
 		constexpr descriptor() = default;
@@ -761,6 +962,21 @@ namespace mo_yanxi::react_flow{
 			}
 		}
 
+		/**
+		 * @brief Whether the output to push differs from the last one, always true unless tagged distinct
+		 */
+		constexpr bool check_changed(const data_carrier<input_type>& pushed){
+			if constexpr(tag.distinct){
+				if constexpr(tag.cache){
+					return (*last_output_).check_changed(pushed.get_ref_view(), std::addressof(*value));
+				} else{
+					return (*last_output_).check_changed(pushed.get_ref_view(), nullptr);
+				}
+			} else{
+				return true;
+			}
+		}
+
 		constexpr void set(data_carrier<input_type>& pushed) requires(tag.cache){
 			*value = pushed.get();
 		}
@@ -805,6 +1021,7 @@ namespace mo_yanxi::react_flow{
 		static constexpr bool identity = std::same_as<input_type, output_type>;
 		static constexpr bool allow_expired = !tag.fresh;
 		static constexpr bool no_push = tag.quiet;
+		static constexpr bool distinct = tag.distinct;
 	};
 
 	template <std::size_t N>
@@ -0,0 +1,130 @@
+module;
+
+export module mo_yanxi.react_flow:fork_join_pool;
+
+import std;
+
+namespace mo_yanxi::react_flow{
+
+/**
+ * @brief Process wide pool used by parallel fan-out propagation.
+ *
+ * The caller of run() executes the first job itself and helps executing queued jobs until its own jobs are done,
+ * so nested fork-join never blocks waiting for an occupied worker.
+ */
+struct fork_join_pool{
+private:
+	struct group{
+		std::size_t remaining{};
+		std::exception_ptr exception{};
+	};
+
+	struct job{
+		group* owner;
+		void (*invoke)(void*, std::size_t);
+		void* context;
+		std::size_t index;
+	};
+
+	std::mutex mutex_{};
+	std::condition_variable_any job_cv_{};
+	std::condition_variable done_cv_{};
+	std::deque<job> jobs_{};
+	std::vector<std::jthread> workers_{};
+
+	explicit fork_join_pool(std::size_t worker_count){
+		workers_.reserve(worker_count);
+		for(std::size_t i = 0; i < worker_count; ++i){
+			workers_.emplace_back([this](std::stop_token stop_token){
+				work(std::move(stop_token));
+			});
+		}
+	}
+
+	void work(std::stop_token stop_token){
+		while(true){
+			job next;
+			{
+				std::unique_lock lock{mutex_};
+				if(!job_cv_.wait(lock, stop_token, [this]{ return !jobs_.empty(); })){
+					return;
+				}
+				next = jobs_.front();
+				jobs_.pop_front();
+			}
+			execute(next);
+		}
+	}
+
+	void execute(const job& job) noexcept{
+		std::exception_ptr exception{};
+		try{
+			job.invoke(job.context, job.index);
+		} catch(...){
+			exception = std::current_exception();
+		}
+
+		std::lock_guard _{mutex_};
+		if(exception && !job.owner->exception){
+			job.owner->exception = std::move(exception);
+		}
+		if(--job.owner->remaining == 0){
+			done_cv_.notify_all();
+		}
+	}
+
+public:
+	static fork_join_pool& instance(){
+		static fork_join_pool pool{std::max(1u, std::thread::hardware_concurrency()) - 1};
+		return pool;
+	}
+
+	[[nodiscard]] std::size_t get_worker_count() const noexcept{
+		return workers_.size();
+	}
+
+	/**
+	 * @brief Invoke fn(0) ... fn(count - 1) in parallel, return after all of them are finished.
+	 *
+	 * The first exception thrown by any job is rethrown on the calling thread.
+	 */
+	template <std::invocable<std::size_t> Fn>
+	void run(std::size_t count, Fn& fn){
+		if(count == 0) return;
+
+		group group{count};
+		constexpr auto invoke = +[](void* context, std::size_t index){
+			std::invoke(*static_cast<Fn*>(context), index);
+		};
+
+		{
+			std::lock_guard _{mutex_};
+			for(std::size_t i = 1; i < count; ++i){
+				jobs_.push_back(job{&group, invoke, std::addressof(fn), i});
+			}
+		}
+		if(count > 1) job_cv_.notify_all();
+
+		execute(job{&group, invoke, std::addressof(fn), 0});
+
+		std::unique_lock lock{mutex_};
+		while(group.remaining != 0){
+			if(!jobs_.empty()){
+				//help instead of idle waiting, the job may come from any group
+				const job next = jobs_.front();
+				jobs_.pop_front();
+				lock.unlock();
+				execute(next);
+				lock.lock();
+			} else{
+				done_cv_.wait(lock);
+			}
+		}
+
+		if(group.exception){
+			std::rethrow_exception(group.exception);
+		}
+	}
+};
+
+}
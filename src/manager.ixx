@@ -1,16 +1,17 @@
 module;
 
+#include <cassert>
 #include <version>
+#include <mo_yanxi/adapted_attributes.hpp>
 #define NODISCARD_ON_ADD [[nodiscard("You should save the reference to node on add")]]
 
 export module mo_yanxi.react_flow:manager;
 
 import :node_interface;
+import :posted_act_queue;
 import mo_yanxi.utility;
-import mo_yanxi.concurrent.mpsc_queue;
 import mo_yanxi.concurrent.swmr_double_buffer;
-import mo_yanxi.flat_set;
-import mo_yanxi.algo;
+import std;
 
 namespace mo_yanxi::react_flow{
 export struct manager;
@@ -38,6 +39,12 @@ struct async_task_base{
 
 private:
 	bool check_during_update_{};
+	//set on the worker right before the task would execute
+	bool skipped_{};
+
+	//profiling only, see manager::stats
+	ADAPTED_NO_UNIQUE_ADDRESS optional_val<std::chrono::steady_clock::time_point, profiling_enabled> enqueued_at_{};
+	ADAPTED_NO_UNIQUE_ADDRESS optional_val<std::chrono::nanoseconds, profiling_enabled> execution_time_{};
 
 public:
 	[[nodiscard]] async_task_base() = default;
@@ -54,6 +61,21 @@ public:
 	virtual void on_finish(manager& manager){
 	}
 
+	/**
+	 * @brief Checked on the worker when the task is dequeued, a cancelled task is never executed.
+	 *
+	 * on_skip is called instead of execute, on_finish is still called on the manager thread.
+	 */
+	[[nodiscard]] virtual bool is_cancelled() const noexcept{
+		return false;
+	}
+
+	/**
+	 * @brief Called on the worker instead of execute, release what was kept for the execution
+	 */
+	virtual void on_skip(){
+	}
+
 	virtual node* get_owner_if_node() noexcept{
 		return nullptr;
 	}
@@ -67,8 +89,35 @@ public:
 	 */
 	virtual void on_update_check(manager& manager){
 	}
+
+	/**
+	 * @brief Called on manager main thread when the task is no longer used, tasks may override it to be recycled.
+	 */
+	virtual void release() noexcept{
+		delete this;
+	}
+
+protected:
+	void set_check_during_update(bool check_during_update) noexcept{
+		check_during_update_ = check_during_update;
+	}
+
+	/**
+	 * @brief Whether the last run skipped execute, valid in on_finish
+	 */
+	[[nodiscard]] bool is_skipped() const noexcept{
+		return skipped_;
+	}
 };
 
+struct async_task_deleter{
+	static void operator()(async_task_base* task) noexcept{
+		task->release();
+	}
+};
+
+using async_task_pointer = std::unique_ptr<async_task_base, async_task_deleter>;
+
 
 struct progressed_async_node_base : async_task_base{
 private:
@@ -78,6 +127,11 @@ private:
 public:
 	using async_task_base::async_task_base;
 
+	void reset_progress() noexcept{
+		last_progress = invalid_progress;
+		progress.store(invalid_progress, std::memory_order_relaxed);
+	}
+
 	void set_progress_done() noexcept{
 		progress.store(f32_to_progress_scl, std::memory_order_release);
 	}
@@ -106,98 +160,519 @@ export struct manager_no_async_t{
 
 export constexpr inline manager_no_async_t manager_no_async{};
 
-#ifdef __cpp_lib_move_only_function
-using AsyncFuncType = std::move_only_function<void()>;
-#else
-using AsyncFuncType = std::function<void()>;
-#endif
+export struct manager_config{
+	/**
+	 * @brief count of async worker threads, 0 to use std::thread::hardware_concurrency()
+	 *
+	 * With a single worker tasks are executed in FIFO order, as before.
+	 */
+	std::size_t async_worker_count{1};
+
+	/**
+	 * @brief slot count of the posted act ring (rounded up to a power of two), acts beyond it fall back to a locked list
+	 */
+	std::size_t posted_act_capacity{1024};
+};
+
+export struct node_stats{
+	const node* owner;
+
+	/**
+	 * @brief see node::set_profile_name
+	 */
+	std::string_view name;
+	node_profile profile;
+};
+
+export struct async_stats{
+	/**
+	 * @brief tasks dequeued after being cancelled and never executed, counted even without profiling
+	 */
+	std::uint64_t skipped;
+	std::uint64_t tasks;
+	/**
+	 * @brief time between push_task and the start of execution, summed over all tasks
+	 */
+	std::chrono::nanoseconds queue_wait_total;
+	std::chrono::nanoseconds queue_wait_max;
+};
+
+/**
+ * @brief Snapshot of profiling counters, empty unless profiling_enabled
+ */
+export struct manager_stats{
+	std::vector<node_stats> nodes;
+	async_stats async;
+};
+
+std::string escape_json(std::string_view str){
+	std::string rst;
+	rst.reserve(str.size());
+	for(const char c : str){
+		switch(c){
+		case '"' : rst += "\\\""; break;
+		case '\\' : rst += "\\\\"; break;
+		case '\n' : rst += "\\n"; break;
+		case '\t' : rst += "\\t"; break;
+		default :
+			if(static_cast<unsigned char>(c) < 0x20){
+				rst += std::format("\\u{:04x}", static_cast<unsigned>(c));
+			} else{
+				rst += c;
+			}
+		}
+	}
+	return rst;
+}
+
+/**
+ * @brief Value source written by other threads, queued in the manager dirty list on write and drained by manager::update
+ */
+struct concurrent_source{
+	friend manager;
+
+private:
+	concurrent_source* next_dirty_{};
+	std::atomic_flag queued_{};
+	std::atomic<manager*> owner_{};
+
+protected:
+	/**
+	 * @brief Called on the manager thread, push the values received since the last drain
+	 */
+	virtual void drain() = 0;
+
+	/**
+	 * @return the manager the source is queued to on write, nullptr after it is detached
+	 */
+	[[nodiscard]] manager* get_owner() const noexcept{
+		return owner_.load(std::memory_order_acquire);
+	}
+
+	void set_owner(manager* owner) noexcept{
+		owner_.store(owner, std::memory_order_release);
+	}
+
+public:
+	virtual ~concurrent_source() = default;
+
+	[[nodiscard]] bool is_queued() const noexcept{
+		return queued_.test(std::memory_order_acquire);
+	}
+};
+
+/**
+ * @brief Generation checked reference to a node of a manager, see manager::get_handle.
+ *
+ * Stays valid while the node is in the manager, and never resolves to another node after it is removed.
+ */
+export struct node_handle{
+	static constexpr std::uint32_t invalid_index = std::numeric_limits<std::uint32_t>::max();
+
+	std::uint32_t index{invalid_index};
+	std::uint32_t generation{};
+
+	constexpr explicit operator bool() const noexcept{
+		return index != invalid_index;
+	}
+
+	constexpr bool operator==(const node_handle&) const noexcept = default;
+};
+
+/**
+ * @brief Generational slot map owning the nodes of a manager.
+ *
+ * Nodes are dense for iteration, the slot of a node is stored in the node so erase is O(1) (swap with the last one).
+ */
+struct node_registry{
+private:
+	static constexpr std::uint32_t invalid_index = node_handle::invalid_index;
+
+	struct slot{
+		std::uint32_t generation{};
+		//index in dense_, invalid_index when free
+		std::uint32_t dense_index{invalid_index};
+		std::uint32_t next_free{invalid_index};
+	};
+
+	std::vector<slot> slots_{};
+	std::vector<node_pointer> dense_{};
+	std::vector<std::uint32_t> dense_slots_{};
+	std::uint32_t free_head_{invalid_index};
+
+public:
+	[[nodiscard]] std::span<const node_pointer> nodes() const noexcept{
+		return dense_;
+	}
+
+	[[nodiscard]] std::size_t size() const noexcept{
+		return dense_.size();
+	}
+
+	[[nodiscard]] bool contains(const node& node) const noexcept{
+		return node.registry_slot_.value < slots_.size()
+			&& slots_[node.registry_slot_.value].dense_index != invalid_index
+			&& dense_[slots_[node.registry_slot_.value].dense_index].get() == &node;
+	}
+
+	node& insert(node_pointer&& ptr){
+		const auto dense_index = static_cast<std::uint32_t>(dense_.size());
+
+		dense_slots_.push_back(invalid_index);
+		try{
+			dense_.push_back(std::move(ptr));
+		} catch(...){
+			dense_slots_.pop_back();
+			throw;
+		}
+
+		std::uint32_t index = free_head_;
+		if(index == invalid_index){
+			index = static_cast<std::uint32_t>(slots_.size());
+			try{
+				slots_.emplace_back();
+			} catch(...){
+				ptr = std::move(dense_.back());
+				dense_.pop_back();
+				dense_slots_.pop_back();
+				throw;
+			}
+		} else{
+			free_head_ = slots_[index].next_free;
+		}
+
+		slot& target = slots_[index];
+		target.dense_index = dense_index;
+		target.next_free = invalid_index;
+		dense_slots_.back() = index;
+
+		node& node = *dense_.back();
+		node.registry_slot_.value = index;
+		return node;
+	}
+
+	/**
+	 * @brief Remove the node in O(1), the returned pointer may hold the last reference to it
+	 */
+	node_pointer erase(node& node) noexcept{
+		assert(contains(node));
+		const std::uint32_t index = std::exchange(node.registry_slot_.value, invalid_index);
+		slot& target = slots_[index];
+
+		node_pointer rst = std::move(dense_[target.dense_index]);
+		if(target.dense_index != dense_.size() - 1){
+			dense_[target.dense_index] = std::move(dense_.back());
+			dense_slots_[target.dense_index] = dense_slots_.back();
+			slots_[dense_slots_[target.dense_index]].dense_index = target.dense_index;
+		}
+		dense_.pop_back();
+		dense_slots_.pop_back();
+
+		++target.generation;
+		target.dense_index = invalid_index;
+		target.next_free = free_head_;
+		free_head_ = index;
+
+		return rst;
+	}
+
+	/**
+	 * @brief Remove every node, slots are released so handles of them are invalidated
+	 */
+	std::vector<node_pointer> take_all() noexcept{
+		for(const node_pointer& ptr : dense_){
+			const std::uint32_t index = std::exchange(ptr->registry_slot_.value, invalid_index);
+			slot& target = slots_[index];
+			++target.generation;
+			target.dense_index = invalid_index;
+			target.next_free = free_head_;
+			free_head_ = index;
+		}
+		dense_slots_.clear();
+		return std::exchange(dense_, {});
+	}
+
+	[[nodiscard]] node_handle handle_of(const node& node) const noexcept{
+		if(!contains(node)) return {};
+		return {node.registry_slot_.value, slots_[node.registry_slot_.value].generation};
+	}
+
+	[[nodiscard]] node* find(node_handle handle) const noexcept{
+		if(handle.index >= slots_.size()) return nullptr;
+		const slot& target = slots_[handle.index];
+		if(target.generation != handle.generation || target.dense_index == invalid_index) return nullptr;
+		return dense_[target.dense_index].get();
+	}
+};
+
+//the manager whose async worker runs on this thread, null on other threads
+thread_local const manager* current_async_worker_owner{};
 
 //TODO support move?
 
 export struct manager{
 private:
-	std::vector<node_pointer> nodes_anonymous_{};
-	std::vector<node*> pulse_subscriber_{};
-	linear_flat_set<std::vector<node*>> expired_nodes_{};
+	struct arena_releaser{
+		static void operator()(node_arena* arena) noexcept{
+			arena->decr_ref();
+		}
+	};
+
+	//nodes added to the manager are pooled by size, the arena lives until the last of them is released
+	std::unique_ptr<node_arena, arena_releaser> node_arena_{node_arena::create()};
+
+	//lock-free intrusive stack of concurrent sources that received values since the last update
+	std::atomic<concurrent_source*> dirty_sources_{};
 
-	using async_task_queue = ccur::mpsc_queue<AsyncFuncType>;
-	async_task_queue pending_received_updates_{};
-	async_task_queue::container_type recycled_queue_container_{};
+	node_registry nodes_{};
+	//the first one is the default group, every node joins it when added
+	std::vector<std::unique_ptr<pulse_group>> pulse_groups_ = [] {
+		std::vector<std::unique_ptr<pulse_group>> groups;
+		groups.push_back(std::make_unique<pulse_group>("default"));
+		return groups;
+	}();
+	//nodes queued by erase_node / clear_isolated, deduplicated by node::expired_
+	std::vector<node*> expired_nodes_{};
 
-	ccur::mpsc_queue<std::unique_ptr<async_task_base>> pending_async_modifiers_{};
-	std::atomic<async_task_base*> under_processing_{};
+	posted_act_queue pending_received_updates_{manager_config{}.posted_act_capacity};
+
+#ifdef __cpp_lib_move_only_function
+	using scheduled_act_type = std::move_only_function<void()>;
+#else
+	using scheduled_act_type = std::function<void()>;
+#endif
+
+	struct scheduled_act{
+		std::chrono::steady_clock::time_point deadline;
+		std::uint64_t sequence;
+		scheduled_act_type act;
+	};
+
+	struct scheduled_act_later{
+		static bool operator()(const scheduled_act& lhs, const scheduled_act& rhs) noexcept{
+			if(lhs.deadline != rhs.deadline) return lhs.deadline > rhs.deadline;
+			return lhs.sequence > rhs.sequence;
+		}
+	};
+
+	//min heap of acts posted by post_at, equal deadlines run in posting order
+	std::vector<scheduled_act> scheduled_acts_{};
+	std::uint64_t scheduled_sequence_{};
+
+	using done_vec_type = std::vector<async_task_pointer>;
+	using task_deque_type = std::deque<async_task_pointer>;
+
+	/**
+	 * @brief Per worker state, the owner pops from the front, other workers steal from the back.
+	 */
+	struct async_worker{
+		std::mutex tasks_mutex{};
+		task_deque_type tasks{};
+		std::atomic<async_task_base*> under_processing{};
+		ccur::swmr_double_buffer<done_vec_type> done_buffer{};
+		std::jthread thread{};
+	};
+
+	std::vector<std::unique_ptr<async_worker>> async_workers_{};
+	std::size_t next_worker_{};
+	std::stop_source async_stop_source_{};
+
+	std::mutex idle_mutex_{};
+	std::condition_variable_any idle_cv_{};
+	//may be transiently negative when a task is stolen before its push is counted
+	std::atomic<std::ptrdiff_t> queued_task_count_{};
+	std::atomic<std::uint64_t> skipped_task_count_{};
+
+	//wake-up of wait_and_update, producers bump the epoch and only notify while the manager thread is parked
+	std::atomic<std::uint64_t> wake_epoch_{};
+	std::uint64_t observed_wake_epoch_{};
+	std::atomic<bool> wait_parked_{};
+	std::mutex wake_mutex_{};
+	std::condition_variable_any wake_cv_{};
 
-	using done_vec_type = std::vector<std::unique_ptr<async_task_base>>;
-	ccur::swmr_double_buffer<done_vec_type> async_done_buffer_{};
 	done_vec_type manager_thread_done_buffer_{};
 
-	std::jthread async_thread_{};
+	struct async_profile{
+		std::atomic<std::uint64_t> tasks{};
+		std::atomic<std::uint64_t> wait_ns{};
+		std::atomic<std::uint64_t> max_wait_ns{};
+	};
+
+	ADAPTED_NO_UNIQUE_ADDRESS optional_val<async_profile, profiling_enabled> async_profile_{};
+
 	bool enable_async_{true};
+	bool async_started_{};
 
 	// 新增：内部提取的懒加载逻辑
 	void ensure_async_thread(){
-		if(enable_async_ && !async_thread_.joinable()){
-			async_thread_ = std::jthread([](std::stop_token stop_token, manager& m){
-				execute_async_tasks(std::move(stop_token), m);
-			}, std::ref(*this));
+		if(!enable_async_ || async_started_) return;
+		async_started_ = true;
+
+		for(std::size_t i = 0; i < async_workers_.size(); ++i){
+			async_workers_[i]->thread = std::jthread([this, i, stop_token = async_stop_source_.get_token()]{
+				execute_async_tasks(stop_token, *this, i);
+			});
+		}
+	}
+
+	void stop_async_workers() noexcept{
+		if(!async_started_) return;
+
+		async_stop_source_.request_stop();
+		idle_cv_.notify_all();
+		for(const auto& worker : async_workers_){
+			if(worker->thread.joinable()) worker->thread.join();
 		}
+
+		async_started_ = false;
+		async_stop_source_ = std::stop_source{};
 	}
 
 	template <std::derived_from<node> T, typename... Args>
 	[[nodiscard]] node_pointer make_node(Args&&... args){
-		return node_pointer(std::in_place_type<T>, std::forward<Args>(args)...);
+		return node_pointer::make_in_arena<T>(*node_arena_, std::forward<Args>(args)...);
+	}
+
+	/**
+	 * @brief Thread safe, called after work for the next update is published
+	 */
+	void notify_work() noexcept{
+		wake_epoch_.fetch_add(1, std::memory_order_seq_cst);
+		if(wait_parked_.load(std::memory_order_seq_cst)){
+			std::lock_guard _{wake_mutex_};
+			wake_cv_.notify_one();
+		}
+	}
+
+	/**
+	 * @brief Park until notify_work, the deadline, or a stop request
+	 * @return true if there is work for update
+	 */
+	bool wait_for_work(const std::stop_token& stop_token, std::chrono::steady_clock::time_point deadline){
+		bool internal_deadline = false;
+		if(const auto next = get_next_wake_time(); next && *next <= deadline){
+			deadline = *next;
+			internal_deadline = true;
+		}
+
+		const auto has_new_work = [this]{
+			return wake_epoch_.load(std::memory_order_seq_cst) != observed_wake_epoch_;
+		};
+
+		std::unique_lock lock{wake_mutex_};
+		wait_parked_.store(true, std::memory_order_seq_cst);
+		bool woken;
+		if(deadline == std::chrono::steady_clock::time_point::max()){
+			woken = wake_cv_.wait(lock, stop_token, has_new_work);
+		} else{
+			woken = wake_cv_.wait_until(lock, stop_token, deadline, has_new_work);
+		}
+		wait_parked_.store(false, std::memory_order_relaxed);
+
+		return woken || (internal_deadline && !stop_token.stop_requested());
+	}
+
+	void link_dirty_source(concurrent_source& source) noexcept{
+		auto* head = dirty_sources_.load(std::memory_order_relaxed);
+		do{
+			source.next_dirty_ = head;
+		} while(!dirty_sources_.compare_exchange_weak(head, &source, std::memory_order_release, std::memory_order_relaxed));
+	}
+
+	void drain_dirty_sources(){
+		concurrent_source* list = dirty_sources_.exchange(nullptr, std::memory_order_acquire);
+		while(list){
+			concurrent_source* next = list->next_dirty_;
+			//clear before drain, a write racing with the drain queues the source again (seq_cst pairs with the writer)
+			list->queued_.clear();
+
+			try{
+				list->drain();
+			} catch(...){
+				for(; next; next = next->next_dirty_){
+					link_dirty_source(*next);
+				}
+				throw;
+			}
+
+			list = next;
+		}
 	}
 
 	void process_node(node& node){
 		node.set_manager(*this);
-		if(node.get_propagate_type() == propagate_type::pulse){
-			pulse_subscriber_.push_back(&node);
+		if(!node.pulse_group_.value){
+			node.pulse_group_.value = pulse_groups_.front().get();
+		}
+		if(node.data_pending_state_ == data_pending_state::waiting_pulse){
+			node.request_pulse();
 		}
 	}
 
 public:
-	[[nodiscard]] manager() = default;
+	[[nodiscard]] manager() : manager(manager_config{}){
+	}
 
 	[[nodiscard]] explicit manager(manager_no_async_t) : enable_async_(false){
 	}
 
-	std::jthread& get_async_working_thread() noexcept{
+	[[nodiscard]] explicit manager(const manager_config& config)
+		: pending_received_updates_(config.posted_act_capacity){
+		std::size_t count = config.async_worker_count;
+		if(count == 0) count = std::max(1u, std::thread::hardware_concurrency());
+
+		async_workers_.reserve(count);
+		for(std::size_t i = 0; i < count; ++i){
+			async_workers_.push_back(std::make_unique<async_worker>());
+		}
+	}
+
+	[[nodiscard]] node_arena& get_node_arena() const noexcept{
+		return *node_arena_;
+	}
+
+	[[nodiscard]] std::size_t get_async_worker_count() const noexcept{
+		return async_workers_.size();
+	}
+
+	std::jthread& get_async_working_thread(std::size_t worker_index = 0) noexcept{
+		assert(worker_index < async_workers_.size());
 		ensure_async_thread(); // 请求访问线程时，若尚未启动则触发启动
-		return async_thread_;
+		return async_workers_[worker_index]->thread;
 	}
 
 	template <std::derived_from<node> T, typename... Args>
 	NODISCARD_ON_ADD T& add_node(Args&&... args){
-		auto& ptr = nodes_anonymous_.emplace_back(this->make_node<T>(std::forward<Args>(args)...));
-		this->process_node(*ptr);
-		return static_cast<T&>(*ptr);
+		node& added = nodes_.insert(this->make_node<T>(std::forward<Args>(args)...));
+		this->process_node(added);
+		return static_cast<T&>(added);
 	}
 
 	template <std::derived_from<node> T>
 	NODISCARD_ON_ADD T& add_node(T&& node){
-		auto& ptr = nodes_anonymous_.emplace_back(node_pointer(std::move(node)));
-		this->process_node(*ptr);
-		return static_cast<T&>(*ptr);
+		node& added = nodes_.insert(this->make_node<T>(std::move(node)));
+		this->process_node(added);
+		return static_cast<T&>(added);
 	}
 
 	template <std::derived_from<node> T>
 	NODISCARD_ON_ADD T& add_node(const T& node){
-		auto& ptr = nodes_anonymous_.emplace_back(node_pointer(node));
-		this->process_node(*ptr);
-		return static_cast<T&>(*ptr);
+		node& added = nodes_.insert(this->make_node<T>(node));
+		this->process_node(added);
+		return static_cast<T&>(added);
 	}
 
 	NODISCARD_ON_ADD node& add_node(node_pointer&& node){
-		auto& ptr = nodes_anonymous_.emplace_back(std::move(node));
-		this->process_node(*ptr);
-		return *ptr;
+		node& added = nodes_.insert(std::move(node));
+		this->process_node(added);
+		return added;
 	}
 
 	void clear_isolated() noexcept{
 		try{
-			for(auto&& node : nodes_anonymous_){
+			for(const node_pointer& node : nodes_.nodes()){
 				if(node->is_isolated()){
-					expired_nodes_.insert(node.get());
+					mark_expired(*node);
 				}
 			}
 		} catch(...){
@@ -205,31 +680,230 @@ public:
 		}
 	}
 
+	[[nodiscard]] std::size_t get_node_count() const noexcept{
+		return nodes_.size();
+	}
+
+	/**
+	 * @return a handle of n, or an invalid handle if n is not in this manager
+	 */
+	[[nodiscard]] node_handle get_handle(const node& n) const noexcept{
+		return nodes_.handle_of(n);
+	}
+
+	/**
+	 * @return the node referred by handle, or nullptr if it is removed
+	 */
+	[[nodiscard]] node* find_node(node_handle handle) const noexcept{
+		return nodes_.find(handle);
+	}
+
+	/**
+	 * @brief Defers eager pushes of cached providers until commit, on the manager thread.
+	 *
+	 * On commit every dirty provider pushes its latest value once, eager modifiers reached by these pushes are staged
+	 * and evaluated once in topological order. Transactions may nest, only the outermost one commits.
+	 * Only providers of this manager are deferred, transactions of other managers on the same thread are independent.
+	 * The destructor commits if commit() is not called.
+	 */
+	struct transaction{
+	private:
+		manager* manager_;
+		int uncaught_on_enter_{std::uncaught_exceptions()};
+		bool active_{true};
+
+	public:
+		[[nodiscard]] explicit transaction(manager& manager) : manager_(std::addressof(manager)){
+			if(update_transaction_state* state = react_flow::find_update_transaction(manager)){
+				++state->depth;
+			} else{
+				current_update_transactions.push_back({.owner = manager_, .depth = 1});
+			}
+		}
+
+		transaction(const transaction& other) = delete;
+		transaction(transaction&& other) noexcept = delete;
+		transaction& operator=(const transaction& other) = delete;
+		transaction& operator=(transaction&& other) noexcept = delete;
+
+		~transaction() noexcept(false){
+			if(!active_) return;
+
+			if(std::uncaught_exceptions() > uncaught_on_enter_){
+				try{
+					commit();
+				} catch(...){
+					//already unwinding
+				}
+			} else{
+				commit();
+			}
+		}
+
+		[[nodiscard]] manager& get_manager() const noexcept{
+			return *manager_;
+		}
+
+		void commit(){
+			if(!active_) return;
+			active_ = false;
+
+			const auto state = std::ranges::find(current_update_transactions, manager_, &update_transaction_state::owner);
+			assert(state != current_update_transactions.end());
+			if(--state->depth != 0) return;
+
+			const auto dirty = std::move(state->dirty);
+			current_update_transactions.erase(state);
+			if(dirty.empty()) return;
+
+			propagation_batch& batch = current_propagation_batch;
+			++batch.depth;
+			++batch.coalescing;
+
+			try{
+				for(const node_pointer& source : dirty){
+					if(source->is_data_expired()){
+						source->pull_and_push(true);
+					}
+				}
+
+				if(--batch.depth == 0 && !batch.scheduled.empty()){
+					batch.drain();
+				}
+			} catch(...){
+				--batch.coalescing;
+				if(batch.depth != 0) batch.abort();
+
+				//values are kept, but sources not flushed yet must be deferrable again
+				for(const node_pointer& source : dirty){
+					source->data_pending_state_ = data_pending_state::done;
+				}
+				throw;
+			}
+
+			--batch.coalescing;
+		}
+	};
+
+	/**
+	 * @brief Invoke fn inside a transaction, see manager::transaction
+	 */
+	template <std::invocable<> Fn>
+	void batch(Fn&& fn){
+		transaction t{*this};
+		std::invoke(std::forward<Fn>(fn));
+		t.commit();
+	}
+
 	/**
 	 * @brief Called from OTHER thread that need do sth on the main data flow thread.
+	 *
+	 * Lock-free and allocation free for callables up to posted_act_queue::inline_size bytes while the ring has room.
+	 * Acts posted by one thread are executed in order on the next update.
 	 */
 	template <std::invocable<> Fn>
 		requires (std::move_constructible<std::remove_cvref_t<Fn>>)
 	void push_posted_act(Fn&& fn){
-		pending_received_updates_.emplace(std::forward<Fn>(fn));
+		pending_received_updates_.push(std::forward<Fn>(fn));
+		notify_work();
+	}
+
+	/**
+	 * @brief Called on the manager thread, run fn on the first update at or after the deadline.
+	 *
+	 * No thread waits for the deadline, acts whose deadline passed run in deadline order after the posted acts.
+	 * Acts scheduled while the due ones are running are executed on the next update.
+	 */
+	template <std::invocable<> Fn>
+		requires (std::move_constructible<std::remove_cvref_t<Fn>>)
+	void post_at(std::chrono::steady_clock::time_point deadline, Fn&& fn){
+		scheduled_acts_.push_back({deadline, scheduled_sequence_++, scheduled_act_type{std::forward<Fn>(fn)}});
+		std::ranges::push_heap(scheduled_acts_, scheduled_act_later{});
+	}
+
+	/**
+	 * @brief Called on the manager thread, see post_at
+	 */
+	template <std::invocable<> Fn>
+		requires (std::move_constructible<std::remove_cvref_t<Fn>>)
+	void post_after(std::chrono::steady_clock::duration delay, Fn&& fn){
+		this->post_at(std::chrono::steady_clock::now() + delay, std::forward<Fn>(fn));
+	}
+
+	/**
+	 * @brief Earliest deadline of the acts scheduled by post_at, e.g. to sleep the main loop until then
+	 */
+	[[nodiscard]] std::optional<std::chrono::steady_clock::time_point> get_next_scheduled_time() const noexcept{
+		if(scheduled_acts_.empty()) return std::nullopt;
+		return scheduled_acts_.front().deadline;
+	}
+
+	[[nodiscard]] std::size_t get_scheduled_count() const noexcept{
+		return scheduled_acts_.size();
+	}
+
+	[[nodiscard]] bool is_async_enabled() const noexcept{
+		return enable_async_;
+	}
+
+	/**
+	 * @brief Thread safe, whether the calling thread is one of the async workers of this manager
+	 */
+	[[nodiscard]] bool is_on_async_worker() const noexcept{
+		return current_async_worker_owner == this;
+	}
+
+	/**
+	 * @brief Thread safe, queue the source to be drained by the next update, no-op if it is already queued.
+	 */
+	void mark_source_dirty(concurrent_source& source) noexcept{
+		if(source.queued_.test_and_set()) return;
+		link_dirty_source(source);
+		notify_work();
+	}
+
+	/**
+	 * @brief Unlink a queued source, called on the manager thread before the source is destroyed
+	 */
+	void erase_dirty_source(concurrent_source& source) noexcept{
+		if(!source.is_queued()) return;
+
+		concurrent_source* list = dirty_sources_.exchange(nullptr, std::memory_order_acquire);
+		while(list){
+			concurrent_source* next = list->next_dirty_;
+			if(list == &source){
+				source.queued_.clear(std::memory_order_relaxed);
+			} else{
+				link_dirty_source(*list);
+			}
+			list = next;
+		}
 	}
 
-	std::stop_token get_manager_stop_token() noexcept{
-		ensure_async_thread();
-		return async_thread_.get_stop_token();
+	/**
+	 * @brief Thread safe, shared by all async workers.
+	 */
+	std::stop_token get_manager_stop_token() const noexcept{
+		return async_stop_source_.get_token();
 	}
 
 	~manager(){
-		if(async_thread_.joinable()){
-			async_thread_.request_stop();
-			pending_async_modifiers_.notify();
-			async_thread_.join();
+		stop_async_workers();
+
+		//cleared before detaching, sources detached afterwards have nothing left to unlink
+		for(auto* list = dirty_sources_.exchange(nullptr, std::memory_order_acquire); list; list = list->next_dirty_){
+			list->queued_.clear(std::memory_order_relaxed);
+		}
+
+		//sources may outlive the manager, they must not reach it later
+		for(const node_pointer& ptr : nodes_.nodes()){
+			detach_node(*ptr);
 		}
 	}
 
 	/**
 	 * @brief 将另一个 manager 的所有状态、节点和任务合并到当前 manager 中。
-	 * 调用此函数会阻塞，直到 other 的异步执行线程完成其当前正在处理的任务。
+	 * 调用此函数会阻塞，直到 other 的所有异步工作线程完成其当前正在处理的任务。
 	 * 合并过程中会自动过滤并丢弃 other 中已标记为过期的节点及相关任务。
 	 */
 	void merge(manager&& other){
@@ -238,102 +912,161 @@ public:
 		}
 
 		// 1. 停止 other 的异步线程（如果已启动）
-		if(other.async_thread_.joinable()){
-			other.async_thread_.request_stop();
-			other.pending_async_modifiers_.notify();
-			other.async_thread_.join();
-		}
+		other.stop_async_workers();
 
-		other.async_done_buffer_.load([this](done_vec_type& other_vec){
-			this->manager_thread_done_buffer_.append_range(std::exchange(other_vec, {}) | std::views::as_rvalue);
-		});
+		for(const auto& worker : other.async_workers_){
+			worker->done_buffer.load([this](done_vec_type& other_vec){
+				this->manager_thread_done_buffer_.append_range(std::exchange(other_vec, {}) | std::views::as_rvalue);
+			});
+		}
 		this->manager_thread_done_buffer_.append_range(
 			std::exchange(other.manager_thread_done_buffer_, {}) | std::views::as_rvalue);
 
-		// 判断是否有需要过滤的过期节点
-		const bool has_expired = !other.expired_nodes_.empty();
-
 		// 3. 转移节点并更新绑定的 manager 引用，同时执行 GC
-		nodes_anonymous_.reserve(nodes_anonymous_.size() + other.nodes_anonymous_.size());
-		for(auto& node_ptr : other.nodes_anonymous_){
-			if(has_expired && other.expired_nodes_.contains(node_ptr.get())){
+		// 被标记为过期的节点暂存到合并结束，其 expired_ 标记用于过滤第 7 步中的任务
+		std::vector<node_pointer> discarded;
+		for(node_pointer& node_ptr : other.nodes_.take_all()){
+			if(node_ptr->expired_.value){
+				detach_node(*node_ptr);
+				discarded.push_back(std::move(node_ptr));
 				continue; // 抛弃被标记为过期的节点
 			}
 			node_ptr->set_manager(*this);
-			nodes_anonymous_.emplace_back(std::move(node_ptr));
-		}
-		other.nodes_anonymous_.clear();
-
-		// 4. 转移脉冲订阅者，同样过滤垃圾节点
-		pulse_subscriber_.reserve(pulse_subscriber_.size() + other.pulse_subscriber_.size());
-		for(auto* p_node : other.pulse_subscriber_){
-			if(has_expired && other.expired_nodes_.contains(p_node)){
-				continue;
+			if(node_ptr->pulse_group_.value){
+				node_ptr->pulse_group_.value = &adopt_pulse_group(*node_ptr->pulse_group_.value);
 			}
-			pulse_subscriber_.push_back(p_node);
+			nodes_.insert(std::move(node_ptr));
 		}
-		other.pulse_subscriber_.clear();
 		other.expired_nodes_.clear(); // 垃圾已被直接丢弃，无需并入 this->expired_nodes_
 
-		// 5. 转移挂起的主线程更新任务
-		async_task_queue::container_type temp_received;
-		if(other.pending_received_updates_.swap(temp_received)){
-			for(auto& fn : temp_received){
-				pending_received_updates_.emplace(std::move(fn));
-			}
+		// 4. 转移脉冲组（按名称合并）及其待触发节点，过期节点已在上一步脱离
+		for(const auto& group : other.pulse_groups_){
+			pulse_group& target = adopt_pulse_group(*group);
+			target.pending_.append_range(group->pending_);
+			group->pending_.clear();
 		}
 
-		// 6. 转移挂起的异步修改任务，过滤掉属于过期节点的任务
-		using async_modifier_queue = ccur::mpsc_queue<std::unique_ptr<async_task_base>>;
-		async_modifier_queue::container_type temp_modifiers;
-		if(other.pending_async_modifiers_.swap(temp_modifiers)){
+		// 5. 转移挂起的跨线程更新，写入线程需在合并期间停止写入
+		for(auto* list = other.dirty_sources_.exchange(nullptr, std::memory_order_acquire); list;){
+			auto* next = list->next_dirty_;
+			link_dirty_source(*list);
+			list = next;
+		}
+
+		// 6. 转移挂起的主线程更新任务与定时任务，定时任务按原顺序重新编号
+		other.pending_received_updates_.transfer_to(pending_received_updates_);
+		std::ranges::sort(other.scheduled_acts_, [](const scheduled_act& lhs, const scheduled_act& rhs){
+			return scheduled_act_later{}(rhs, lhs);
+		});
+		for(scheduled_act& act : other.scheduled_acts_){
+			post_at(act.deadline, std::move(act.act));
+		}
+		other.scheduled_acts_.clear();
+
+		// 7. 转移挂起的异步修改任务，过滤掉属于过期节点的任务
+		for(const auto& worker : other.async_workers_){
+			task_deque_type temp_modifiers;
+			{
+				std::lock_guard _{worker->tasks_mutex};
+				temp_modifiers.swap(worker->tasks);
+			}
+
 			for(auto& task : temp_modifiers){
-				if(has_expired && other.expired_nodes_.contains(task->get_owner_if_node())){
+				if(const node* owner = task->get_owner_if_node(); owner && owner->expired_.value){
 					continue;
 				}
 				push_task(std::move(task)); // 这里的 push_task 会自动判定并懒启动当前 manager 的线程
 			}
 		}
+		other.queued_task_count_.store(0, std::memory_order_relaxed);
+		skipped_task_count_.fetch_add(other.skipped_task_count_.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+
+		for(const node_pointer& node_ptr : discarded){
+			node_ptr->expired_.value = false;
+		}
+
+		//the merged work must not wait for another notification
+		notify_work();
 	}
 
 	void push_task(std::unique_ptr<async_task_base> task){
+		this->push_task(async_task_pointer{task.release()});
+	}
+
+	/**
+	 * @param task left to the caller if queuing throws
+	 */
+	void push_task(async_task_pointer&& task){
+		if constexpr(profiling_enabled){
+			*task->enqueued_at_ = std::chrono::steady_clock::now();
+		}
+
 		if(enable_async_){
 			ensure_async_thread(); // 懒加载触发点
-			pending_async_modifiers_.push(std::move(task));
+
+			auto& worker = *async_workers_[next_worker_];
+			next_worker_ = (next_worker_ + 1) % async_workers_.size();
+			{
+				std::lock_guard _{worker.tasks_mutex};
+				worker.tasks.push_back(std::move(task));
+			}
+			{
+				std::lock_guard _{idle_mutex_};
+				queued_task_count_.fetch_add(1, std::memory_order_release);
+			}
+			idle_cv_.notify_one();
 		} else{
 			// manager_no_async 模式退化为同步执行
-			task->execute(*this);
-			finalize_task(*task);
+			const async_task_pointer owned = std::move(task);
+			execute_task(*owned);
+			finalize_task(*owned);
 		}
 	}
 
 	void update(){
+		//work published from now on wakes the next wait_and_update, even if this update already handles it
+		observed_wake_epoch_ = wake_epoch_.load(std::memory_order_seq_cst);
+
 		if(!expired_nodes_.empty()){
-			// 使用提取的条件移除逻辑，一行搞定 GC
-			remove_nodes_by_predicate([this](node* ptr){
-				return expired_nodes_.contains(ptr);
-			});
-			expired_nodes_.clear();
+			remove_expired_nodes();
 		}
 
-		for(const auto& pulse_subscriber : pulse_subscriber_){
-			pulse_subscriber->on_pulse_received(*this);
+		if(dirty_sources_.load(std::memory_order_relaxed)){
+			//latest values of several sources feeding one join are committed together
+			transaction t{*this};
+			drain_dirty_sources();
+			t.commit();
 		}
 
-		if(pending_received_updates_.swap(recycled_queue_container_)){
-			for(auto&& fn : recycled_queue_container_){
-				fn();
+		const auto now = std::chrono::steady_clock::now();
+		for(const auto& group : pulse_groups_){
+			if(!group->pending_.empty() && group->consume_tick(now)){
+				pulse(*group);
 			}
-			recycled_queue_container_.clear();
 		}
 
-		auto cur = under_processing_.load(std::memory_order_acquire);
-		if(cur && cur->check_during_update_) cur->on_update_check(*this);
+		pending_received_updates_.drain();
+
+		if(!scheduled_acts_.empty()){
+			run_scheduled_acts(now);
+		}
+
+		for(const auto& worker : async_workers_){
+			auto cur = worker->under_processing.load(std::memory_order_acquire);
+			if(cur && cur->check_during_update_) cur->on_update_check(*this);
+		}
 
 		{
-			async_done_buffer_.load([&](done_vec_type& vec){
-				std::ranges::swap(manager_thread_done_buffer_, vec);
-			});
+			for(const auto& worker : async_workers_){
+				worker->done_buffer.load([this](done_vec_type& vec){
+					if(manager_thread_done_buffer_.empty()){
+						std::ranges::swap(manager_thread_done_buffer_, vec);
+					} else{
+						manager_thread_done_buffer_.append_range(vec | std::views::as_rvalue);
+						vec.clear();
+					}
+				});
+			}
 
 			for(auto&& task_base : manager_thread_done_buffer_){
 				finalize_task(*task_base); // 统一调用提取的收尾逻辑
@@ -342,64 +1075,417 @@ public:
 		}
 	}
 
+	/**
+	 * @brief Called on the manager thread, park it until update has work or the timeout elapses, then update.
+	 *
+	 * Woken without polling by posted acts, finished async tasks and concurrent sources, and by the deadlines of
+	 * post_at and of pulse groups with pending nodes.
+	 * @return false if the timeout elapsed without work
+	 */
+	bool wait_and_update(std::chrono::steady_clock::duration timeout){
+		const auto now = std::chrono::steady_clock::now();
+		const auto deadline = timeout >= std::chrono::steady_clock::time_point::max() - now
+			? std::chrono::steady_clock::time_point::max()
+			: now + timeout;
+		return wait_and_update_until(deadline);
+	}
+
+	/**
+	 * @brief See wait_and_update
+	 */
+	bool wait_and_update_until(std::chrono::steady_clock::time_point deadline){
+		const bool has_work = wait_for_work(std::stop_token{}, deadline);
+		update();
+		return has_work;
+	}
+
+	/**
+	 * @brief Called on the manager thread, update whenever there is work until stop is requested, idle without polling.
+	 *
+	 * A stop request wakes the thread immediately, the pending work is left to the next update.
+	 */
+	void run_until(const std::stop_token& stop_token){
+		while(true){
+			wait_for_work(stop_token, std::chrono::steady_clock::time_point::max());
+			if(stop_token.stop_requested()) return;
+			update();
+		}
+	}
+
+	/**
+	 * @brief Earliest time update has work without being notified: acts of post_at, and pulse groups with pending nodes
+	 */
+	[[nodiscard]] std::optional<std::chrono::steady_clock::time_point> get_next_wake_time() const noexcept{
+		std::optional<std::chrono::steady_clock::time_point> next = get_next_scheduled_time();
+		for(const auto& group : pulse_groups_){
+			if(group->pending_.empty()) continue;
+			const auto tick = group->period_ <= std::chrono::nanoseconds::zero()
+				? std::chrono::steady_clock::time_point{}
+				: group->next_tick_;
+			if(!next || tick < *next) next = tick;
+		}
+		return next;
+	}
+
+	[[nodiscard]] pulse_group& get_default_pulse_group() const noexcept{
+		return *pulse_groups_.front();
+	}
+
+	/**
+	 * @brief Create a pulse clock ticking at most once per period on update, or return the existing group of the name.
+	 *
+	 * A zero period ticks on every update, nodes join it by node::set_pulse_group.
+	 */
+	pulse_group& add_pulse_group(std::string_view name, std::chrono::nanoseconds period){
+		if(pulse_group* group = find_pulse_group(name)){
+			group->set_period(period);
+			return *group;
+		}
+		return *pulse_groups_.emplace_back(std::make_unique<pulse_group>(name, period));
+	}
+
+	[[nodiscard]] pulse_group* find_pulse_group(std::string_view name) const noexcept{
+		const auto itr = std::ranges::find(pulse_groups_, name, &pulse_group::name_);
+		return itr == pulse_groups_.end() ? nullptr : itr->get();
+	}
+
+	/**
+	 * @brief Tick the group immediately regardless of its period, e.g. driven by an external clock.
+	 *
+	 * Only nodes with pending pulse data are visited. Pulse nodes fed during the tick are delivered in the same tick,
+	 * so a chain of pulse nodes settles in one pulse.
+	 */
+	void pulse(pulse_group& group){
+		while(!group.pending_.empty()){
+			std::ranges::swap(group.ticking_, group.pending_);
+
+			std::size_t i = 0;
+			try{
+				for(; i < group.ticking_.size(); ++i){
+					node* target = group.ticking_[i];
+					if(!target) continue; //destroyed during the tick
+					target->pulse_queued_.value = false;
+					target->on_pulse_received(*this);
+				}
+			} catch(...){
+				//keep the nodes not visited yet for the next tick
+				for(++i; i < group.ticking_.size(); ++i){
+					if(group.ticking_[i]) group.pending_.push_back(group.ticking_[i]);
+				}
+				group.ticking_.clear();
+				throw;
+			}
+
+			group.ticking_.clear();
+		}
+	}
+
+	/**
+	 * @brief Count of cancelled async tasks dropped at dequeue without executing, see async_task_base::is_cancelled
+	 */
+	[[nodiscard]] std::uint64_t get_skipped_task_count() const noexcept{
+		return skipped_task_count_.load(std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief Profiling counters of every node in the manager and of the async queue
+	 */
+	[[nodiscard]] manager_stats stats() const{
+		manager_stats rst{};
+		rst.async.skipped = get_skipped_task_count();
+
+		if constexpr(profiling_enabled){
+			rst.nodes.reserve(nodes_.size());
+			for(const node_pointer& n : nodes_.nodes()){
+				rst.nodes.push_back({n.get(), n->get_profile_name(), n->get_profile()});
+			}
+
+			const async_profile& profile = *async_profile_;
+			rst.async = {
+					rst.async.skipped,
+					profile.tasks.load(std::memory_order_relaxed),
+					std::chrono::nanoseconds{profile.wait_ns.load(std::memory_order_relaxed)},
+					std::chrono::nanoseconds{profile.max_wait_ns.load(std::memory_order_relaxed)}
+				};
+		}
+
+		return rst;
+	}
+
+	void reset_stats() noexcept{
+		skipped_task_count_.store(0, std::memory_order_relaxed);
+
+		if constexpr(profiling_enabled){
+			for(const node_pointer& n : nodes_.nodes()){
+				n->reset_profile();
+			}
+
+			async_profile& profile = *async_profile_;
+			profile.tasks.store(0, std::memory_order_relaxed);
+			profile.wait_ns.store(0, std::memory_order_relaxed);
+			profile.max_wait_ns.store(0, std::memory_order_relaxed);
+		}
+	}
+
+	/**
+	 * @brief Start recording trace events (process wide), events recorded before are discarded
+	 */
+	static void begin_trace(){
+		if constexpr(profiling_enabled){
+			auto& recorder = trace_recorder::instance();
+			std::lock_guard _{recorder.mutex};
+			recorder.events.clear();
+			recorder.origin = std::chrono::steady_clock::now();
+			recorder.recording.store(true, std::memory_order_relaxed);
+		}
+	}
+
+	static void end_trace() noexcept{
+		if constexpr(profiling_enabled){
+			trace_recorder::instance().recording.store(false, std::memory_order_relaxed);
+		}
+	}
+
+	/**
+	 * @brief Write the recorded events of nodes in this manager as Chrome trace-event JSON (chrome://tracing, Perfetto)
+	 */
+	void export_chrome_trace(std::ostream& stream) const{
+		stream << R"({"traceEvents":[)";
+
+		if constexpr(profiling_enabled){
+			std::unordered_map<const node*, std::string> names;
+			for(const node_pointer& n : nodes_.nodes()){
+				const std::string_view name = n->get_profile_name();
+				names.emplace(n.get(), name.empty()
+					? std::format("node@{}", static_cast<const void*>(n.get()))
+					: react_flow::escape_json(name));
+			}
+
+			std::unordered_map<std::thread::id, std::size_t> threads;
+			auto& recorder = trace_recorder::instance();
+			std::lock_guard _{recorder.mutex};
+
+			bool first = true;
+			for(const trace_event& event : recorder.events){
+				const auto itr = names.find(event.owner);
+				if(itr == names.end()) continue;
+
+				const auto tid = threads.try_emplace(event.thread, threads.size()).first->second;
+				const std::chrono::duration<double, std::micro> ts = event.begin - recorder.origin;
+				const std::chrono::duration<double, std::micro> dur = event.duration;
+
+				if(!first) stream << ',';
+				first = false;
+				stream << std::format(R"({{"name":"{}","cat":"{}","ph":"X","ts":{:.3f},"dur":{:.3f},"pid":0,"tid":{}}})",
+					itr->second, event.category, ts.count(), dur.count(), tid);
+			}
+		}
+
+		stream << R"(],"displayTimeUnit":"ns"})";
+	}
+
+	bool export_chrome_trace(const std::filesystem::path& path) const{
+		std::ofstream stream{path};
+		if(!stream) return false;
+		export_chrome_trace(stream);
+		return static_cast<bool>(stream);
+	}
+
+	/**
+	 * @brief Queue n for removal on the next update, its pending async tasks are dropped then.
+	 * @return false if n is not in this manager or already queued
+	 */
 	bool erase_node(node& n) noexcept
 	try{
-		//TODO cancel n's async task?
-		return expired_nodes_.insert(std::addressof(n));
+		if(!nodes_.contains(n)) return false;
+		return mark_expired(n);
 	} catch(const std::bad_alloc&){
-		// 在异常 fallback 路径中，复用统一移除逻辑
-		return remove_nodes_by_predicate([&n](node* ptr){
-			return ptr == &n;
-		});
+		// 在异常 fallback 路径中，直接移除
+		n.expired_.value = true;
+		remove_expired_tasks();
+		n.expired_.value = false;
+		detach_node(n);
+		nodes_.erase(n);
+		return true;
 	}
 
 private:
 	// ================= 新增的提取逻辑 ================= //
 
+	pulse_group& adopt_pulse_group(const pulse_group& group){
+		if(pulse_group* found = find_pulse_group(group.name_)) return *found;
+		return *pulse_groups_.emplace_back(std::make_unique<pulse_group>(group.name_, group.period_));
+	}
+
 	/**
 	 * @brief 提取出的：处理 async_task 结束与检查的通用逻辑
 	 */
 	void finalize_task(async_task_base& task){
+		if constexpr(profiling_enabled){
+			if(node* owner = task.get_owner_if_node(); owner && !task.skipped_){
+				node_profile& profile = *owner->profile_;
+				++profile.recomputations;
+				profile.self_time += *task.execution_time_;
+				profile.total_time += *task.execution_time_;
+			}
+		}
+
 		task.on_finish(*this);
 		if(task.check_during_update_){
 			task.on_update_check(*this);
 		}
 	}
 
+	void run_scheduled_acts(std::chrono::steady_clock::time_point now){
+		const auto end = scheduled_sequence_;
+		while(!scheduled_acts_.empty()){
+			const scheduled_act& front = scheduled_acts_.front();
+			if(front.deadline > now || front.sequence >= end) break;
+
+			std::ranges::pop_heap(scheduled_acts_, scheduled_act_later{});
+			auto act = std::move(scheduled_acts_.back().act);
+			scheduled_acts_.pop_back();
+			act();
+		}
+	}
+
+	bool mark_expired(node& n){
+		if(n.expired_.value) return false;
+		expired_nodes_.push_back(&n);
+		n.expired_.value = true;
+		return true;
+	}
+
 	/**
-	 * @brief 提取出的：基于谓词，统一清理挂起任务、脉冲订阅和匿名节点列表中的目标
-	 * @return 返回是否从匿名节点列表 (nodes_anonymous_) 中成功移除了元素
+	 * @brief Leave the pulse group, removed nodes may outlive the manager
 	 */
-	template <typename Predicate>
-	bool remove_nodes_by_predicate(Predicate&& is_target){
-		pending_async_modifiers_.erase_if([&](const std::unique_ptr<async_task_base>& ptr){
-			return is_target(ptr->get_owner_if_node());
-		});
-		algo::erase_unique_if_unstable(pulse_subscriber_, [&](node* ptr){
-			return is_target(ptr);
-		});
-		return algo::erase_unique_if_unstable(nodes_anonymous_, [&](const node_pointer& ptr){
-			return is_target(ptr.get());
-		});
+	static void detach_node(node& n) noexcept{
+		if(n.pulse_queued_.value){
+			n.pulse_group_.value->erase_pending(n);
+			n.pulse_queued_.value = false;
+		}
+		n.pulse_group_.value = nullptr;
+		n.reset_manager();
 	}
 
-	static void execute_async_tasks(std::stop_token stop_token, manager& manager){
-		while(!stop_token.stop_requested()){
-			auto&& task = manager.pending_async_modifiers_.consume([&stop_token]{
-				return stop_token.stop_requested();
+	/**
+	 * @brief Drop queued async tasks owned by nodes marked expired, O(queued tasks)
+	 */
+	void remove_expired_tasks() noexcept{
+		for(const auto& worker : async_workers_){
+			std::lock_guard _{worker->tasks_mutex};
+			const auto erased = std::erase_if(worker->tasks, [](const async_task_pointer& ptr){
+				const node* owner = ptr->get_owner_if_node();
+				return owner && owner->expired_.value;
 			});
+			queued_task_count_.fetch_sub(static_cast<std::ptrdiff_t>(erased), std::memory_order_relaxed);
+		}
+	}
 
-			if(task){
-				manager.under_processing_.store(task.value().get(), std::memory_order_release);
-				task.value()->execute(manager);
-				manager.under_processing_.store(nullptr, std::memory_order_release);
+	/**
+	 * @brief 统一清理过期节点：挂起任务、脉冲组与节点表，节点表的移除为 O(1)
+	 */
+	void remove_expired_nodes() noexcept{
+		remove_expired_tasks();
+
+		for(node* n : expired_nodes_){
+			n->expired_.value = false;
+			detach_node(*n);
+			//may release the last reference
+			nodes_.erase(*n);
+		}
+		expired_nodes_.clear();
+	}
 
-				manager.async_done_buffer_.modify([&](done_vec_type& vec){
-					vec.push_back(std::move(task.value()));
-				});
+	/**
+	 * @brief Execute the task on the current thread, measures the queue wait and execution time when profiling
+	 */
+	void execute_task(async_task_base& task){
+		if constexpr(profiling_enabled){
+			const auto begin = std::chrono::steady_clock::now();
+
+			async_profile& profile = *async_profile_;
+			const auto wait = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(begin - *task.enqueued_at_).count());
+			profile.tasks.fetch_add(1, std::memory_order_relaxed);
+			profile.wait_ns.fetch_add(wait, std::memory_order_relaxed);
+			auto max = profile.max_wait_ns.load(std::memory_order_relaxed);
+			while(max < wait && !profile.max_wait_ns.compare_exchange_weak(max, wait, std::memory_order_relaxed)){
+			}
+
+			task.execute(*this);
+
+			const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin);
+			*task.execution_time_ = duration;
+
+			if(auto& recorder = trace_recorder::instance(); recorder.recording.load(std::memory_order_relaxed)){
+				if(const node* owner = task.get_owner_if_node()){
+					recorder.record({owner, "async", std::this_thread::get_id(), begin, duration});
+				}
+			}
+		} else{
+			task.execute(*this);
+		}
+	}
+
+	async_task_pointer acquire_task(std::size_t worker_index){
+		const auto pop = [this](async_worker& worker, bool steal) -> async_task_pointer{
+			std::lock_guard _{worker.tasks_mutex};
+			if(worker.tasks.empty()) return nullptr;
+
+			async_task_pointer task;
+			if(steal){
+				task = std::move(worker.tasks.back());
+				worker.tasks.pop_back();
+			} else{
+				task = std::move(worker.tasks.front());
+				worker.tasks.pop_front();
+			}
+			queued_task_count_.fetch_sub(1, std::memory_order_relaxed);
+			return task;
+		};
+
+		if(auto task = pop(*async_workers_[worker_index], false)) return task;
+
+		const auto count = async_workers_.size();
+		for(std::size_t offset = 1; offset < count; ++offset){
+			if(auto task = pop(*async_workers_[(worker_index + offset) % count], true)) return task;
+		}
+
+		return nullptr;
+	}
+
+	static void execute_async_tasks(std::stop_token stop_token, manager& manager, std::size_t worker_index){
+		auto& worker = *manager.async_workers_[worker_index];
+		current_async_worker_owner = &manager;
+
+		while(!stop_token.stop_requested()){
+			auto task = manager.acquire_task(worker_index);
+
+			if(!task){
+				std::unique_lock lock{manager.idle_mutex_};
+				if(!manager.idle_cv_.wait(lock, stop_token, [&manager]{
+					return manager.queued_task_count_.load(std::memory_order_acquire) > 0;
+				})){
+					return;
+				}
+				continue;
+			}
+
+			task->skipped_ = task->is_cancelled();
+			if(task->skipped_){
+				//superseded before it started, only its completion is delivered
+				task->on_skip();
+				manager.skipped_task_count_.fetch_add(1, std::memory_order_relaxed);
 			} else{
-				return;
+				worker.under_processing.store(task.get(), std::memory_order_release);
+				manager.execute_task(*task);
+				worker.under_processing.store(nullptr, std::memory_order_release);
 			}
+
+			worker.done_buffer.modify([&](done_vec_type& vec){
+				vec.push_back(std::move(task));
+			});
+			manager.notify_work();
 		}
 	}
 };
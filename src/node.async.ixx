@@ -26,6 +26,23 @@ namespace mo_yanxi::react_flow{
 		}
 	};
 
+	/**
+	 * @brief Bounds the tasks an async node dispatches, see async_node::set_backpressure
+	 */
+	export struct async_backpressure{
+		/**
+		 * @brief max count of dispatched but not finished tasks, 0 for unlimited
+		 */
+		std::size_t max_in_flight{};
+
+		/**
+		 * @brief max count of arguments waiting for a free slot, ignored by backpressure_policy::coalesce (always 1)
+		 */
+		std::size_t queue_capacity{};
+
+		backpressure_policy policy{backpressure_policy::drop_newest};
+	};
+
 	template <typename T, typename... Args>
 	struct async_node_task;
 
@@ -54,8 +71,20 @@ namespace mo_yanxi::react_flow{
 
 		async_type async_type_{async_type::def};
 		std::size_t dispatched_count_{};
+		//serials used to drop out-of-order results when tasks run on multiple workers
+		std::size_t dispatch_serial_{};
+		std::size_t stored_serial_{};
 		std::stop_source stop_source_{std::nostopstate};
 
+		//finished tasks kept for reuse, so steady-state dispatch allocates nothing
+		std::vector<std::unique_ptr<async_node_task<Ret, Args...>>> recycled_tasks_{};
+		std::size_t task_recycle_limit_{4};
+
+		async_backpressure backpressure_{};
+		//arguments waiting for an in-flight slot, oldest first
+		std::deque<decay_argument_type> pending_arguments_{};
+		std::size_t dropped_count_{};
+
 	public:
 
 		[[nodiscard]] async_node() = default;
@@ -75,12 +104,79 @@ namespace mo_yanxi::react_flow{
 			return dispatched_count_;
 		}
 
+		[[nodiscard]] std::size_t get_task_recycle_limit() const noexcept{
+			return task_recycle_limit_;
+		}
+
+		/**
+		 * @brief Set the max count of finished tasks kept for reuse, 0 to allocate a task on every dispatch.
+		 */
+		void set_task_recycle_limit(std::size_t limit){
+			task_recycle_limit_ = limit;
+			if(recycled_tasks_.size() > limit){
+				recycled_tasks_.resize(limit);
+			}
+		}
+
+		[[nodiscard]] const async_backpressure& get_backpressure() const noexcept{
+			return backpressure_;
+		}
+
+		/**
+		 * @brief Limit in-flight tasks, arguments arriving at the limit are queued or dropped by the policy.
+		 *
+		 * Queued arguments are dispatched in order when tasks finish. Excess queued arguments are dropped.
+		 */
+		void set_backpressure(const async_backpressure& backpressure){
+			backpressure_ = backpressure;
+			const std::size_t capacity = get_queue_capacity();
+			while(pending_arguments_.size() > capacity){
+				if(backpressure_.policy == backpressure_policy::drop_newest){
+					pending_arguments_.pop_back();
+				} else{
+					pending_arguments_.pop_front();
+				}
+				++dropped_count_;
+			}
+			dispatch_pending();
+		}
+
+		/**
+		 * @brief Count of arguments waiting for an in-flight slot
+		 */
+		[[nodiscard]] std::size_t get_queue_depth() const noexcept{
+			return pending_arguments_.size();
+		}
+
+		/**
+		 * @brief Count of arguments dropped (or coalesced into newer ones) by the backpressure policy
+		 */
+		[[nodiscard]] std::size_t get_dropped_count() const noexcept{
+			return dropped_count_;
+		}
+
+		/**
+		 * @brief Whether new arguments would be dropped or replace queued ones, producers may throttle on it
+		 */
+		[[nodiscard]] bool is_saturated() const noexcept{
+			return is_at_in_flight_limit() && pending_arguments_.size() >= get_queue_capacity();
+		}
+
+		/**
+		 * @brief Drop queued arguments, in-flight tasks are not affected
+		 */
+		void clear_queue() noexcept{
+			pending_arguments_.clear();
+		}
+
 		request_pass_handle<typename base::return_output_type> request_raw(bool allow_expired) override{
+			this->profile_count(&node_profile::pulls);
 			if constexpr (descriptor_trait<Ret>::cached){
 				const auto state = this->get_data_state();
 				if(state == data_state::expired && !allow_expired){
 					return make_request_handle_unexpected<typename base::return_output_type>(data_state::expired);
 				}else{
+					this->profile_count(&node_profile::cache_hits);
 					return react_flow::make_request_handle_expected_from_data_storage(this->get_cache(), state == data_state::expired);
 				}
 			}
@@ -106,6 +202,10 @@ namespace mo_yanxi::react_flow{
 			return progress_provider_->disconnect_successor(node);
 		}
 
+		[[nodiscard]] bool requires_manager_thread() const noexcept override{
+			return true;
+		}
+
 		[[nodiscard]] std::stop_token get_stop_token() const noexcept{
 			assert(stop_source_.stop_possible());
 			return stop_source_.get_token();
@@ -131,6 +231,57 @@ namespace mo_yanxi::react_flow{
 	protected:
 		void apply_arguments(typename base::argument_pass_type& args){
 			assert(manager_);
+
+			auto decay_args = [&]<std::size_t ...Idx>(std::index_sequence<Idx...>){
+				return decay_argument_type{std::get<Idx>(args).get() ...};
+			}(std::index_sequence_for<Args...>{});
+
+			if(!is_at_in_flight_limit()){
+				dispatch(std::move(decay_args));
+				return;
+			}
+
+			const std::size_t capacity = get_queue_capacity();
+			if(pending_arguments_.size() < capacity){
+				pending_arguments_.push_back(std::move(decay_args));
+				return;
+			}
+
+			++dropped_count_;
+			switch(backpressure_.policy){
+			case backpressure_policy::drop_newest : break;
+			case backpressure_policy::drop_oldest :
+				if(capacity == 0) break;
+				pending_arguments_.pop_front();
+				pending_arguments_.push_back(std::move(decay_args));
+				break;
+			case backpressure_policy::coalesce : pending_arguments_.back() = std::move(decay_args);
+				break;
+			default : std::unreachable();
+			}
+		}
+
+		[[nodiscard]] bool is_at_in_flight_limit() const noexcept{
+			return backpressure_.max_in_flight != 0 && dispatched_count_ >= backpressure_.max_in_flight;
+		}
+
+		[[nodiscard]] std::size_t get_queue_capacity() const noexcept{
+			if(backpressure_.policy == backpressure_policy::coalesce) return 1;
+			return backpressure_.queue_capacity;
+		}
+
+		/**
+		 * @brief Dispatch queued arguments while in-flight slots are free, called on the manager thread
+		 */
+		void dispatch_pending(){
+			while(!pending_arguments_.empty() && !is_at_in_flight_limit()){
+				auto decay_args = std::move(pending_arguments_.front());
+				pending_arguments_.pop_front();
+				dispatch(std::move(decay_args));
+			}
+		}
+
+		void dispatch(decay_argument_type&& decay_args){
 			if(stop_source_.stop_possible()){
 				if(async_type_ == async_type::async_latest){
 					if(async_cancel()){
@@ -143,11 +294,26 @@ namespace mo_yanxi::react_flow{
 
 			++dispatched_count_;
 
+			if(recycled_tasks_.empty()){
+				manager_->push_task(async_task_pointer{new async_node_task<Ret, Args...>(*this, std::move(decay_args))});
+			} else{
+				auto task = std::move(recycled_tasks_.back());
+				recycled_tasks_.pop_back();
+				task->reuse(*this, std::move(decay_args));
+				manager_->push_task(async_task_pointer{task.release()});
+			}
+		}
 
-			manager_->push_task(std::make_unique<async_node_task<Ret, Args...>>(*this, [&]<std::size_t ...Idx>(std::index_sequence<Idx...>){
-				return decay_argument_type{std::get<Idx>(args).get() ...};
-			}(std::index_sequence_for<Args...>{})));
-
+		/**
+		 * @return false if the task should be destroyed instead
+		 */
+		bool recycle_task(async_node_task<Ret, Args...>* task) noexcept
+		try{
+			if(recycled_tasks_.size() >= task_recycle_limit_) return false;
+			recycled_tasks_.emplace_back(task);
+			return true;
+		} catch(...){
+			return false;
 		}
 
 		base::return_pass_type apply(const async_context& ctx, decay_argument_type&& args){
@@ -167,6 +333,8 @@ namespace mo_yanxi::react_flow{
 		node_pointer modifier_{};
 		std::stop_token stop_token_{};
 
+		std::size_t serial_{};
+
 		type::decay_argument_type arguments_{};
 		type::return_pass_type result_{};
 
@@ -178,20 +346,69 @@ namespace mo_yanxi::react_flow{
 		[[nodiscard]] explicit async_node_task(type& modifier, type::decay_argument_type&& args) :
 			progressed_async_node_base{!modifier.progress_provider_->get_outputs().empty()},
 			modifier_(std::addressof(modifier)), stop_token_(modifier.get_stop_token()),
+			serial_(++modifier.dispatch_serial_),
 			arguments_{std::move(args)}{
 		}
 
+		/**
+		 * @brief Reset a recycled task as if it is newly constructed
+		 */
+		void reuse(type& modifier, type::decay_argument_type&& args){
+			set_check_during_update(!modifier.progress_provider_->get_outputs().empty());
+			reset_progress();
+			modifier_.reset(std::addressof(modifier));
+			stop_token_ = modifier.get_stop_token();
+			serial_ = ++modifier.dispatch_serial_;
+			arguments_ = std::move(args);
+		}
+
+		void release() noexcept override{
+			type& owner = get();
+
+			//the owner must outlive its free list, never recycle when this task holds the last reference
+			if(owner.get_reference_count() > 1 && owner.recycle_task(this)){
+				//arguments are moved out on execution, the result must not be kept alive
+				stop_token_ = {};
+				result_ = type::return_pass_type{};
+				modifier_.reset();
+				return;
+			}
+
+			delete this;
+		}
+
 		void on_finish(manager& manager) override{
-			--get().dispatched_count_;
+			auto& node = get();
+			--node.dispatched_count_;
 			set_progress_done();
+			node.dispatch_pending();
+
+			if(is_skipped()) return;
+
+			//a newer task of async_latest may finish first on another worker, never overwrite its result
+			if(node.async_type_ == async_type::async_latest && serial_ < node.stored_serial_){
+				return;
+			}
+			node.stored_serial_ = serial_;
 
-			get().store_result(std::move(result_));
+			node.store_result(std::move(result_));
 		}
 
 		node* get_owner_if_node() noexcept override{
 			return modifier_.get();
 		}
 
+		/**
+		 * @brief Cancelled by async_cancel, or superseded by a newer dispatch of async_latest
+		 */
+		[[nodiscard]] bool is_cancelled() const noexcept override{
+			return stop_token_.stop_requested();
+		}
+
+		void on_skip() override{
+			arguments_ = {};
+		}
+
 		void on_update_check(manager& manager) override{
 			if(const auto prog = get_progress(); prog.changed){
 				get().progress_provider_->update_value(prog);
@@ -0,0 +1,216 @@
+module;
+
+#include <cassert>
+#include <mo_yanxi/adapted_attributes.hpp>
+
+export module mo_yanxi.react_flow:batch;
+
+import :manager;
+import :node_interface;
+import :modifier;
+import mo_yanxi.meta_programming;
+import std;
+
+namespace mo_yanxi::react_flow{
+	/**
+	 * @brief Contiguous chunk of trivially copyable values propagated as one update.
+	 *
+	 * The framework cost of a push is paid once per chunk, elementwise stages run as plain loops over the chunk.
+	 */
+	export
+	template <typename T>
+	struct value_batch{
+		static_assert(std::is_trivially_copyable_v<T>, "batches carry trivially copyable values");
+
+		using value_type = T;
+
+	private:
+		std::vector<T> values_{};
+
+	public:
+		[[nodiscard]] value_batch() = default;
+
+		[[nodiscard]] explicit value_batch(std::vector<T>&& values) noexcept : values_(std::move(values)){
+		}
+
+		[[nodiscard]] explicit value_batch(std::span<const T> values) : values_(values.begin(), values.end()){
+		}
+
+		[[nodiscard]] value_batch(std::initializer_list<T> values) : values_(values){
+		}
+
+		[[nodiscard]] std::span<const T> span() const noexcept{
+			return values_;
+		}
+
+		[[nodiscard]] std::span<T> span() noexcept{
+			return values_;
+		}
+
+		[[nodiscard]] const T* data() const noexcept{
+			return values_.data();
+		}
+
+		[[nodiscard]] T* data() noexcept{
+			return values_.data();
+		}
+
+		[[nodiscard]] std::size_t size() const noexcept{
+			return values_.size();
+		}
+
+		[[nodiscard]] bool empty() const noexcept{
+			return values_.empty();
+		}
+
+		[[nodiscard]] auto begin() const noexcept{
+			return values_.begin();
+		}
+
+		[[nodiscard]] auto end() const noexcept{
+			return values_.end();
+		}
+
+		[[nodiscard]] const T& operator[](std::size_t index) const noexcept{
+			assert(index < values_.size());
+			return values_[index];
+		}
+
+		[[nodiscard]] T& operator[](std::size_t index) noexcept{
+			assert(index < values_.size());
+			return values_[index];
+		}
+
+		/**
+		 * @brief Resize keeping the capacity, new values are value initialized
+		 */
+		void resize(std::size_t size){
+			values_.resize(size);
+		}
+
+		void reserve(std::size_t capacity){
+			values_.reserve(capacity);
+		}
+
+		void clear() noexcept{
+			values_.clear();
+		}
+
+		void assign(std::span<const T> values){
+			values_.assign(values.begin(), values.end());
+		}
+
+		void push_back(const T& value){
+			values_.push_back(value);
+		}
+
+		bool operator==(const value_batch&) const noexcept = default;
+	};
+
+	/**
+	 * @brief Apply fn to the elements at the same index of every input, the output has the size of the shortest input.
+	 *
+	 * A plain indexed loop over raw pointers, which the compiler vectorizes when fn is inlined.
+	 */
+	export
+	template <typename Out, typename Fn, typename... Ins>
+		requires (sizeof...(Ins) > 0 && std::is_invocable_r_v<Out, const Fn&, const Ins&...>)
+	FORCE_INLINE void transform_batch(value_batch<Out>& output, const Fn& fn, const value_batch<Ins>&... inputs){
+		const std::size_t count = std::min({inputs.size()...});
+		output.resize(count);
+
+		Out* const dst = output.data();
+		[&]<std::size_t... Idx>(std::tuple<const Ins*...> srcs, std::index_sequence<Idx...>){
+			for(std::size_t i = 0; i < count; ++i){
+				dst[i] = std::invoke(fn, std::get<Idx>(srcs)[i]...);
+			}
+		}(std::tuple<const Ins*...>{inputs.data()...}, std::index_sequence_for<Ins...>{});
+	}
+
+	template <typename Fn, typename Out, typename Tup>
+	struct batch_kernel_helper;
+
+	template <typename Fn, typename Out, typename... Ins>
+	struct batch_kernel_helper<Fn, Out, std::tuple<Ins...>>{
+		template <typename FnTy>
+		FORCE_INLINE static auto lift(FnTy&& fn){
+			return [f = std::forward<FnTy>(fn)] FORCE_INLINE (value_batch<Out>& output, const value_batch<std::decay_t<Ins>>&... inputs){
+				react_flow::transform_batch(output, f, inputs...);
+			};
+		}
+	};
+
+	/**
+	 * @brief Lift an elementwise function `Out(In...)` to a transformer of value_batch<In>... into value_batch<Out>.
+	 *
+	 * The output chunk is a node-owned buffer (see inplace_transformer), so steady-state chunks allocate nothing and
+	 * successors read it without copying.
+	 */
+	export
+	template <typename Fn>
+	[[nodiscard]] FORCE_INLINE auto make_batch_transformer(propagate_type data_propagate_type, Fn&& fn){
+		using traits = function_traits<std::remove_pointer_t<std::decay_t<Fn>>>;
+		using output_type = std::decay_t<typename traits::return_type>;
+		using args = typename traits::mem_func_args_type;
+
+		return react_flow::make_inplace_transformer(data_propagate_type,
+			batch_kernel_helper<std::decay_t<Fn>, output_type, args>::lift(std::forward<Fn>(fn)));
+	}
+
+	export
+	template <typename Fn>
+	[[nodiscard]] FORCE_INLINE auto make_batch_transformer(Fn&& fn){
+		return react_flow::make_batch_transformer(propagate_type::eager, std::forward<Fn>(fn));
+	}
+
+	/**
+	 * @brief Push every value of a chunk to scalar successors in order, so existing scalar nodes consume batched sources.
+	 *
+	 * When pulled, it yields the last value of the chunk (a value initialized one for an empty chunk).
+	 */
+	export
+	template <typename T>
+	struct batch_unpacker final : modifier_base<batch_unpacker<T>, descriptor<T>, descriptor<value_batch<T>>>{
+	private:
+		using base = modifier_base<batch_unpacker, descriptor<T>, descriptor<value_batch<T>>>;
+		friend base;
+
+	public:
+		[[nodiscard]] batch_unpacker() = default;
+
+		[[nodiscard]] explicit batch_unpacker(propagate_type data_propagate_type)
+			: base(data_propagate_type){
+		}
+
+		[[nodiscard]] request_pass_handle<typename base::return_output_type> request_raw(bool allow_expired) override{
+			return this->request_from_inputs(allow_expired);
+		}
+
+	private:
+		void apply_arguments(typename base::argument_pass_type& args){
+			this->profile_count(&node_profile::recomputations);
+			const value_batch<T>& batch = std::get<0>(args).get_ref_view();
+			for(const T& value : batch){
+				this->store_result(typename base::return_pass_type{value});
+			}
+		}
+
+		typename base::return_pass_type apply(base::argument_pass_type& arguments){
+			const value_batch<T>& batch = std::get<0>(arguments).get_ref_view();
+			return typename base::return_pass_type{batch.empty() ? T{} : batch.span().back()};
+		}
+	};
+
+	/**
+	 * @brief Add a batch_unpacker between a batched producer and a scalar consumer
+	 * @return the unpacker, removed with the manager like any other node
+	 */
+	export
+	template <typename T>
+	batch_unpacker<T>& connect_unbatched(manager& manager, type_aware_node<value_batch<T>>& producer, node& consumer){
+		auto& unpacker = manager.add_node<batch_unpacker<T>>();
+		producer.connect_successor(unpacker);
+		unpacker.connect_successor(consumer);
+		return unpacker;
+	}
+}
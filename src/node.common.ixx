@@ -165,4 +165,26 @@ auto make_listener(Fn&& fn){
 	return react_flow::make_listener(propagate_type::eager, std::forward<Fn>(fn));
 }
 
+/**
+ * @brief Listen to a value_batch with `void(std::span<const T>)`, the chunk is viewed without copying
+ */
+export
+template <typename Fn>
+auto make_batch_listener(propagate_type data_propagate_type, Fn&& fn){
+	using FnTrait = mo_yanxi::function_traits<std::decay_t<Fn>>::mem_func_args_type;
+	static_assert(std::tuple_size_v<FnTrait> == 1);
+	using SpanTy = std::decay_t<std::tuple_element_t<0, FnTrait>>;
+	using ValueTy = std::remove_const_t<typename SpanTy::element_type>;
+
+	return react_flow::make_listener(data_propagate_type, [f = std::forward<Fn>(fn)](const value_batch<ValueTy>& batch){
+		std::invoke(f, batch.span());
+	});
+}
+
+export
+template <typename Fn>
+auto make_batch_listener(Fn&& fn){
+	return react_flow::make_batch_listener(propagate_type::eager, std::forward<Fn>(fn));
+}
+
 }
\ No newline at end of file
@@ -0,0 +1,693 @@
+module;
+
+#include <cassert>
+#include <mo_yanxi/adapted_attributes.hpp>
+
+export module mo_yanxi.react_flow:coroutine;
+
+import :manager;
+import :node_interface;
+import :modifier;
+import mo_yanxi.meta_programming;
+import std;
+
+namespace mo_yanxi::react_flow{
+	template <typename T>
+	struct coro_owner{
+		/**
+		 * @brief Called on the manager thread with the value of a finished coroutine
+		 */
+		virtual void on_coroutine_return(std::size_t serial, T&& value) = 0;
+
+		/**
+		 * @brief Called on the manager thread when a coroutine is finished or destroyed before finishing
+		 */
+		virtual void on_coroutine_end(std::size_t serial) noexcept = 0;
+
+	protected:
+		~coro_owner() = default;
+	};
+
+	/**
+	 * @brief State of a coroutine node shared by its awaiters, the manager is read on every suspension so merged nodes follow their new manager
+	 */
+	struct coro_node_base{
+	protected:
+		manager* manager_{};
+
+		~coro_node_base() = default;
+
+	public:
+		[[nodiscard]] manager& get_manager() const noexcept{
+			assert(manager_);
+			return *manager_;
+		}
+
+		virtual node& get_node() noexcept = 0;
+	};
+
+	struct coro_promise_base{
+		/**
+		 * @brief Called on the manager thread, deliver the result and destroy the finished frame
+		 */
+		virtual void complete() = 0;
+
+		/**
+		 * @brief Destroy the finished frame without delivering the result
+		 */
+		virtual void discard() noexcept = 0;
+
+	protected:
+		~coro_promise_base() = default;
+	};
+
+	//set by the final suspension of a node coroutine, consumed by the code that resumed it on the same thread
+	thread_local coro_promise_base* finished_coroutine{};
+
+	/**
+	 * @brief Resume on the manager thread, completes the coroutine in place if it finishes before suspending again
+	 */
+	void resume_coroutine(std::coroutine_handle<> handle){
+		handle.resume();
+		if(coro_promise_base* finished = std::exchange(finished_coroutine, nullptr)){
+			finished->complete();
+		}
+	}
+
+	/**
+	 * @brief Owns a suspended coroutine until it is resumed, the frame is destroyed if the resumer is dropped
+	 */
+	struct coro_resumer{
+	private:
+		std::coroutine_handle<> handle_{};
+
+	public:
+		[[nodiscard]] explicit coro_resumer(std::coroutine_handle<> handle) noexcept : handle_(handle){
+		}
+
+		coro_resumer(const coro_resumer& other) = delete;
+
+		coro_resumer(coro_resumer&& other) noexcept : handle_(std::exchange(other.handle_, {})){
+		}
+
+		coro_resumer& operator=(const coro_resumer& other) = delete;
+
+		coro_resumer& operator=(coro_resumer&& other) noexcept{
+			if(this == &other) return *this;
+			if(handle_) handle_.destroy();
+			handle_ = std::exchange(other.handle_, {});
+			return *this;
+		}
+
+		~coro_resumer(){
+			if(handle_) handle_.destroy();
+		}
+
+		/**
+		 * @brief Called on the manager thread
+		 */
+		void operator()(){
+			resume_coroutine(std::exchange(handle_, {}));
+		}
+
+		[[nodiscard]] std::coroutine_handle<> release() noexcept{
+			return std::exchange(handle_, {});
+		}
+	};
+
+	/**
+	 * @brief Resume a coroutine on an async worker, the result of a coroutine finished there is delivered in on_finish
+	 */
+	struct coro_resume_task final : async_task_base{
+	private:
+		coro_resumer resumer_;
+		node_pointer owner_;
+		coro_promise_base* finished_{};
+
+	public:
+		[[nodiscard]] coro_resume_task(std::coroutine_handle<> handle, node& owner) noexcept
+			: resumer_(handle), owner_(owner){
+		}
+
+		/**
+		 * @brief Give up the coroutine before the task is queued, it is neither resumed nor destroyed by the task
+		 */
+		[[nodiscard]] std::coroutine_handle<> release_handle() noexcept{
+			return resumer_.release();
+		}
+
+		~coro_resume_task() override{
+			if(finished_) finished_->discard();
+		}
+
+		void execute(manager& manager) override{
+			resumer_.release().resume();
+			finished_ = std::exchange(finished_coroutine, nullptr);
+		}
+
+		void on_finish(manager& manager) override{
+			if(coro_promise_base* finished = std::exchange(finished_, nullptr)){
+				finished->complete();
+			}
+		}
+
+		node* get_owner_if_node() noexcept override{
+			return owner_.get();
+		}
+	};
+
+	/**
+	 * @brief Base of awaitables accepted in node coroutines, other awaitables may resume on threads the node does not know
+	 */
+	export struct coro_awaiter_base{
+	};
+
+	export
+	template <typename T>
+	struct coro_task{
+		static_assert(!std::is_reference_v<T> && !std::is_void_v<T>, "coroutine nodes must return values");
+
+		struct promise_type final : coro_promise_base{
+		private:
+			friend coro_task;
+
+			coro_owner<T>* owner_{};
+			node_pointer keep_alive_{};
+			std::size_t serial_{};
+
+			std::optional<T> value_{};
+			std::exception_ptr exception_{};
+
+			struct final_awaiter{
+				static bool await_ready() noexcept{
+					return false;
+				}
+
+				static void await_suspend(std::coroutine_handle<promise_type> handle) noexcept{
+					finished_coroutine = std::addressof(handle.promise());
+				}
+
+				static void await_resume() noexcept{
+				}
+			};
+
+		public:
+			[[nodiscard]] promise_type() = default;
+
+			~promise_type(){
+				if(owner_) owner_->on_coroutine_end(serial_);
+			}
+
+			coro_task get_return_object() noexcept{
+				return coro_task{std::coroutine_handle<promise_type>::from_promise(*this)};
+			}
+
+			static std::suspend_always initial_suspend() noexcept{
+				return {};
+			}
+
+			static final_awaiter final_suspend() noexcept{
+				return {};
+			}
+
+			template <typename U>
+				requires (std::constructible_from<T, U&&>)
+			void return_value(U&& value){
+				value_.emplace(std::forward<U>(value));
+			}
+
+			void unhandled_exception() noexcept{
+				exception_ = std::current_exception();
+			}
+
+			template <typename Awaiter>
+				requires (std::derived_from<std::remove_cvref_t<Awaiter>, coro_awaiter_base>)
+			Awaiter&& await_transform(Awaiter&& awaiter) noexcept{
+				return std::forward<Awaiter>(awaiter);
+			}
+
+			void complete() override{
+				const auto handle = std::coroutine_handle<promise_type>::from_promise(*this);
+
+				coro_owner<T>* owner = std::exchange(owner_, nullptr);
+				const std::size_t serial = serial_;
+				//the node must outlive the delivery of the result
+				const node_pointer keep_alive = std::move(keep_alive_);
+				std::optional<T> value = std::move(value_);
+				const std::exception_ptr exception = std::move(exception_);
+				handle.destroy();
+
+				owner->on_coroutine_end(serial);
+				if(exception) std::rethrow_exception(exception);
+				if(value) owner->on_coroutine_return(serial, std::move(*value));
+			}
+
+			void discard() noexcept override{
+				std::coroutine_handle<promise_type>::from_promise(*this).destroy();
+			}
+		};
+
+	private:
+		using handle_type = std::coroutine_handle<promise_type>;
+		handle_type handle_{};
+
+		[[nodiscard]] explicit coro_task(handle_type handle) noexcept : handle_(handle){
+		}
+
+	public:
+		[[nodiscard]] coro_task() = default;
+
+		coro_task(const coro_task& other) = delete;
+
+		coro_task(coro_task&& other) noexcept : handle_(std::exchange(other.handle_, {})){
+		}
+
+		coro_task& operator=(const coro_task& other) = delete;
+
+		coro_task& operator=(coro_task&& other) noexcept{
+			if(this == &other) return *this;
+			if(handle_) handle_.destroy();
+			handle_ = std::exchange(other.handle_, {});
+			return *this;
+		}
+
+		~coro_task(){
+			if(handle_) handle_.destroy();
+		}
+
+		/**
+		 * @brief Called on the manager thread, run the body until its first suspension, the owner receives its result
+		 */
+		void start(coro_owner<T>& owner, node& node, std::size_t serial){
+			assert(handle_);
+			promise_type& promise = handle_.promise();
+			promise.owner_ = std::addressof(owner);
+			promise.keep_alive_.reset(std::addressof(node));
+			promise.serial_ = serial;
+			resume_coroutine(std::exchange(handle_, {}));
+		}
+	};
+
+	struct coro_timer{
+	private:
+		std::coroutine_handle<> handle_;
+		bool fired_{};
+
+	public:
+		[[nodiscard]] explicit coro_timer(std::coroutine_handle<> handle) noexcept : handle_(handle){
+		}
+
+		coro_timer(const coro_timer& other) = delete;
+		coro_timer& operator=(const coro_timer& other) = delete;
+
+		~coro_timer(){
+			if(!fired_) handle_.destroy();
+		}
+
+		/**
+		 * @brief Called on the manager thread by the deadline or by a stop request, whichever comes first
+		 */
+		void fire(){
+			if(std::exchange(fired_, true)) return;
+			resume_coroutine(handle_);
+		}
+
+		/**
+		 * @brief Give up the coroutine before the timer is armed, it is neither resumed nor destroyed by the timer
+		 */
+		void disarm() noexcept{
+			fired_ = true;
+		}
+	};
+
+	export
+	struct coro_context{
+		std::stop_token node_stop_token{};
+		coro_node_base* owner{};
+
+		[[nodiscard]] bool stop_requested() const noexcept{
+			return node_stop_token.stop_requested() || owner->get_manager().get_manager_stop_token().stop_requested();
+		}
+
+		struct schedule_awaiter : coro_awaiter_base{
+			coro_node_base* owner;
+
+			[[nodiscard]] bool await_ready() const noexcept{
+				const manager& manager = owner->get_manager();
+				return !manager.is_async_enabled() || manager.is_on_async_worker();
+			}
+
+			void await_suspend(std::coroutine_handle<> handle) const{
+				async_task_pointer task{new coro_resume_task{handle, owner->get_node()}};
+				try{
+					owner->get_manager().push_task(std::move(task));
+				} catch(...){
+					//the coroutine is resumed with the exception, the frame must not be destroyed with the task
+					if(task) (void)static_cast<coro_resume_task&>(*task).release_handle();
+					throw;
+				}
+			}
+
+			static void await_resume() noexcept{
+			}
+		};
+
+		struct manager_thread_awaiter : coro_awaiter_base{
+			coro_node_base* owner;
+
+			[[nodiscard]] bool await_ready() const noexcept{
+				return !owner->get_manager().is_on_async_worker();
+			}
+
+			void await_suspend(std::coroutine_handle<> handle) const{
+				coro_resumer resumer{handle};
+				try{
+					owner->get_manager().push_posted_act(std::move(resumer));
+				} catch(...){
+					//the coroutine is resumed with the exception, the frame must not be destroyed with the resumer
+					(void)resumer.release();
+					throw;
+				}
+			}
+
+			static void await_resume() noexcept{
+			}
+		};
+
+		struct sleep_awaiter : coro_awaiter_base{
+		private:
+			struct stop_wake{
+				coro_node_base* owner;
+				std::weak_ptr<coro_timer> timer;
+
+				void operator()() const{
+					owner->get_manager().push_posted_act([timer = timer]{
+						if(const auto locked = timer.lock()) locked->fire();
+					});
+				}
+			};
+
+			coro_node_base* owner_;
+			std::stop_token stop_token_;
+			std::chrono::steady_clock::time_point deadline_;
+			std::optional<std::stop_callback<stop_wake>> on_stop_{};
+
+			/**
+			 * @brief Called on the manager thread, the timer can not fire before the caller returns
+			 */
+			void arm(const std::shared_ptr<coro_timer>& timer){
+				owner_->get_manager().post_at(deadline_, [timer]{
+					timer->fire();
+				});
+
+				if(stop_token_.stop_possible()){
+					on_stop_.emplace(stop_token_, stop_wake{owner_, timer});
+				}
+			}
+
+		public:
+			[[nodiscard]] sleep_awaiter(coro_node_base* owner, std::stop_token stop_token, std::chrono::steady_clock::time_point deadline) noexcept
+				: owner_(owner), stop_token_(std::move(stop_token)), deadline_(deadline){
+			}
+
+			[[nodiscard]] bool await_ready() const noexcept{
+				return stop_token_.stop_requested() || deadline_ <= std::chrono::steady_clock::now();
+			}
+
+			void await_suspend(std::coroutine_handle<> handle){
+				manager& manager = owner_->get_manager();
+				const auto timer = std::make_shared<coro_timer>(handle);
+
+				try{
+					if(manager.is_on_async_worker()){
+						//nothing can resume the coroutine before the timer is armed, the worker never touches the frame again
+						manager.push_posted_act([this, timer]{
+							arm(timer);
+						});
+					} else{
+						arm(timer);
+					}
+				} catch(...){
+					//the coroutine is resumed with the exception, the frame must not be destroyed with the timer
+					timer->disarm();
+					throw;
+				}
+			}
+
+			/**
+			 * @return false if woken by a stop request before the deadline
+			 */
+			[[nodiscard]] bool await_resume() const noexcept{
+				return !stop_token_.stop_requested();
+			}
+		};
+
+		/**
+		 * @brief Continue on an async worker, no-op if already on one or the manager has no async workers
+		 */
+		[[nodiscard]] schedule_awaiter schedule() const noexcept{
+			return {{}, owner};
+		}
+
+		/**
+		 * @brief Continue on the manager thread in the next update, no-op if already on it.
+		 *
+		 * The graph may only be accessed on the manager thread, e.g. to pull the cached result of another node.
+		 */
+		[[nodiscard]] manager_thread_awaiter resume_on_manager() const noexcept{
+			return {{}, owner};
+		}
+
+		/**
+		 * @brief Suspend without holding a thread until the first update at or after the deadline, or until the node stop is requested.
+		 *
+		 * Resumed on the manager thread.
+		 */
+		[[nodiscard]] sleep_awaiter sleep_until(std::chrono::steady_clock::time_point deadline) const noexcept{
+			return sleep_awaiter{owner, node_stop_token, deadline};
+		}
+
+		/**
+		 * @brief See sleep_until
+		 */
+		[[nodiscard]] sleep_awaiter sleep_for(std::chrono::steady_clock::duration duration) const noexcept{
+			return sleep_until(std::chrono::steady_clock::now() + duration);
+		}
+	};
+
+	/**
+	 * @brief Async node running a coroutine per update, the body co_awaits the awaitables of coro_context.
+	 *
+	 * A suspended coroutine holds no thread, so many in-flight coroutines share the async workers.
+	 * The body starts on the manager thread, take the context and the arguments by value since they must outlive the call.
+	 */
+	export
+	template <typename Ret, typename... Args>
+		requires (spec_of_descriptor<Ret> && (spec_of_descriptor<Args> && ...))
+	struct async_coro_node : modifier_base<async_coro_node<Ret, Args...>, Ret, Args...>, coro_node_base, coro_owner<typename descriptor_trait<Ret>::input_type>{
+		using base = modifier_base<async_coro_node, Ret, Args...>;
+		using result_type = typename descriptor_trait<Ret>::input_type;
+		using task_type = coro_task<result_type>;
+
+	private:
+		friend base;
+
+		async_type async_type_{async_type::def};
+		std::size_t dispatched_count_{};
+		//serials used to drop out-of-order results of async_latest
+		std::size_t dispatch_serial_{};
+		std::size_t stored_serial_{};
+		std::stop_source stop_source_{std::nostopstate};
+
+	public:
+		[[nodiscard]] async_coro_node() = default;
+
+		[[nodiscard]] explicit async_coro_node(propagate_type data_propagate_type, async_type async_type)
+			: base(data_propagate_type), async_type_(async_type){
+		}
+
+		async_coro_node(const async_coro_node& other) = delete;
+		async_coro_node(async_coro_node&& other) noexcept = default;
+		async_coro_node& operator=(const async_coro_node& other) = delete;
+		async_coro_node& operator=(async_coro_node&& other) noexcept = default;
+
+		void set_manager(manager& manager) override{
+			manager_ = &manager;
+		}
+
+		node& get_node() noexcept final{
+			return *this;
+		}
+
+#pragma region Async_Settings
+
+		/**
+		 * @brief Count of coroutines started and not finished yet
+		 */
+		[[nodiscard]] std::size_t get_dispatched() const noexcept{
+			return dispatched_count_;
+		}
+
+		[[nodiscard]] async_type get_async_type() const noexcept{
+			return async_type_;
+		}
+
+		void set_async_type(const async_type async_type) noexcept{
+			async_type_ = async_type;
+		}
+
+		[[nodiscard]] bool requires_manager_thread() const noexcept override{
+			return true;
+		}
+
+		/**
+		 * @brief Request stop of the running coroutines, sleeping ones are woken on the next update
+		 */
+		bool async_cancel() noexcept{
+			if(dispatched_count_ == 0) return false;
+			if(!stop_source_.stop_possible()) return false;
+			stop_source_.request_stop();
+			stop_source_ = std::stop_source{std::nostopstate};
+			return true;
+		}
+
+		request_pass_handle<typename base::return_output_type> request_raw(bool allow_expired) override{
+			this->profile_count(&node_profile::pulls);
+			if constexpr (descriptor_trait<Ret>::cached){
+				const auto state = this->get_data_state();
+				if(state == data_state::expired && !allow_expired){
+					return make_request_handle_unexpected<typename base::return_output_type>(data_state::expired);
+				}else{
+					this->profile_count(&node_profile::cache_hits);
+					return react_flow::make_request_handle_expected_from_data_storage(this->get_cache(), state == data_state::expired);
+				}
+			}
+			if(this->get_dispatched() > 0){
+				return make_request_handle_unexpected<typename base::return_output_type>(data_state::awaiting);
+			}
+			return make_request_handle_unexpected<typename base::return_output_type>(data_state::failed);
+		}
+
+		[[nodiscard]] data_state get_data_state() const noexcept override{
+			if constexpr(descriptor_trait<Ret>::cached){
+				return this->get_cache_data_state();
+			}else{
+				return get_dispatched() ? data_state::awaiting : data_state::failed;
+			}
+		}
+#pragma endregion
+
+	protected:
+		void apply_arguments(typename base::argument_pass_type& args){
+			assert(manager_);
+
+			if(stop_source_.stop_possible()){
+				if(async_type_ == async_type::async_latest){
+					if(async_cancel()){
+						stop_source_ = {};
+					}
+				}
+			} else if(!stop_source_.stop_requested()){
+				stop_source_ = {};
+			}
+
+			task_type task = [&, this]<std::size_t... Idx>(std::index_sequence<Idx...>){
+				return this->operator()(coro_context{stop_source_.get_token(), this}, std::get<Idx>(args).get() ...);
+			}(std::index_sequence_for<Args...>{});
+
+			++dispatched_count_;
+			task.start(*this, *this, ++dispatch_serial_);
+		}
+
+		void on_coroutine_return(std::size_t serial, result_type&& value) override{
+			//a newer coroutine of async_latest may finish first, never overwrite its result
+			if(async_type_ == async_type::async_latest && serial < stored_serial_){
+				return;
+			}
+			stored_serial_ = serial;
+
+			this->store_result(std::move(value));
+		}
+
+		void on_coroutine_end(std::size_t serial) noexcept override{
+			--dispatched_count_;
+		}
+
+		virtual task_type operator()(coro_context ctx, typename descriptor_trait<Args>::output_type&&... args) = 0;
+	};
+
+	export
+	template <typename Ret, typename Fn, typename... Args>
+	struct coro_transformer final : async_coro_node<Ret, Args...>{
+	private:
+		Fn fn;
+
+	public:
+		coro_transformer() = default;
+
+		[[nodiscard]] explicit coro_transformer(propagate_type data_propagate_type, async_type async_type, Fn&& fn)
+			: async_coro_node<Ret, Args...>(data_propagate_type, async_type), fn(std::move(fn)){
+		}
+
+		[[nodiscard]] explicit coro_transformer(propagate_type data_propagate_type, async_type async_type, const Fn& fn)
+			: async_coro_node<Ret, Args...>(data_propagate_type, async_type), fn(fn){
+		}
+
+		coro_transformer(const coro_transformer& other) = delete;
+		coro_transformer(coro_transformer&& other) noexcept = default;
+		coro_transformer& operator=(const coro_transformer& other) = delete;
+		coro_transformer& operator=(coro_transformer&& other) noexcept = default;
+
+	protected:
+		async_coro_node<Ret, Args...>::task_type operator()(
+			coro_context ctx,
+			descriptor_trait<Args>::output_type&&... args) override{
+			return std::invoke(fn, std::move(ctx), std::move(args)...);
+		}
+	};
+
+	template <typename T>
+	struct coro_task_value;
+
+	template <typename T>
+	struct coro_task_value<coro_task<T>>{
+		using type = T;
+	};
+
+	export
+	template <typename... Args, typename Fn>
+		requires (sizeof...(Args) > 0)
+	[[nodiscard]] FORCE_INLINE auto make_coro_transformer(propagate_type data_propagate_type, async_type async_type, Fn&& fn){
+		using task_type = std::invoke_result_t<std::decay_t<Fn>&, coro_context, typename descriptor_trait<make_descriptor_t<Args>>::output_type&&...>;
+		using return_type = typename coro_task_value<task_type>::type;
+		return coro_transformer<descriptor<return_type>, std::decay_t<Fn>, make_descriptor_t<Args>...>{
+			data_propagate_type, async_type, std::forward<Fn>(fn)
+		};
+	}
+
+	export
+	template <typename Fn>
+	[[nodiscard]] FORCE_INLINE auto make_coro_transformer(propagate_type data_propagate_type, async_type async_type, Fn&& fn){
+		using Args = function_traits<std::decay_t<Fn>>::mem_func_args_type;
+
+		static_assert(std::tuple_size_v<Args> > 1);
+		static_assert(std::same_as<std::tuple_element_t<0, Args>, coro_context>, "the coroutine must take coro_context by value first");
+
+		return [&]<std::size_t ...Idx>(std::index_sequence<Idx...>){
+			static_assert((!std::is_reference_v<std::tuple_element_t<Idx + 1, Args>> && ...), "coroutine arguments must be taken by value, they outlive the call");
+			return react_flow::make_coro_transformer<descriptor<std::decay_t<std::tuple_element_t<Idx + 1, Args>>> ...>(data_propagate_type, async_type, std::forward<Fn>(fn));
+		}(std::make_index_sequence<std::tuple_size_v<Args> - 1>{});
+	}
+
+	export
+	template <typename Fn>
+	[[nodiscard]] FORCE_INLINE auto make_coro_transformer(propagate_type data_propagate_type, Fn&& fn){
+		return react_flow::make_coro_transformer(data_propagate_type, async_type::async_latest, std::forward<Fn>(fn));
+	}
+
+	export
+	template <typename Fn>
+	[[nodiscard]] FORCE_INLINE auto make_coro_transformer(Fn&& fn){
+		return react_flow::make_coro_transformer(propagate_type::eager, async_type::async_latest, std::forward<Fn>(fn));
+	}
+}
@@ -10,6 +10,10 @@ module;
 #define MO_YANXI_DATA_FLOW_ENABLE_RING_CHECK 1
 #endif
 
+#ifndef MO_YANXI_DATA_FLOW_ENABLE_PROFILING
+#define MO_YANXI_DATA_FLOW_ENABLE_PROFILING 0
+#endif
+
 // #ifndef MO_YANXI_DATA_FLOW_DISABLE_THREAD_CHECK
 // #define THREAD_CHECK
 // #endif
@@ -19,6 +23,8 @@ module;
 export module mo_yanxi.react_flow:node_interface;
 import std;
 
+import :fork_join_pool;
+
 import mo_yanxi.type_register;
 export import mo_yanxi.react_flow.util;
 
@@ -29,6 +35,100 @@ export struct manager;
 
 export struct node;
 
+/**
+ * @brief Size-class pooled memory for nodes, shared by a manager and every node allocated from it.
+ *
+ * Reference counted (on the manager thread, like nodes), so nodes may outlive the manager that created them.
+ */
+export
+struct node_arena{
+private:
+	std::pmr::unsynchronized_pool_resource resource_;
+	unsigned reference_count_{};
+
+	[[nodiscard]] explicit node_arena(std::pmr::memory_resource* upstream)
+		: resource_(upstream){
+	}
+
+public:
+	node_arena(const node_arena& other) = delete;
+	node_arena(node_arena&& other) noexcept = delete;
+	node_arena& operator=(const node_arena& other) = delete;
+	node_arena& operator=(node_arena&& other) noexcept = delete;
+
+	/**
+	 * @return an arena with one reference held by the caller
+	 */
+	[[nodiscard]] static node_arena* create(std::pmr::memory_resource* upstream = std::pmr::get_default_resource()){
+		auto* arena = new node_arena{upstream};
+		arena->incr_ref();
+		return arena;
+	}
+
+	void incr_ref() noexcept{
+		++reference_count_;
+	}
+
+	void decr_ref() noexcept{
+		if(--reference_count_ == 0){
+			delete this;
+		}
+	}
+
+	[[nodiscard]] unsigned get_reference_count() const noexcept{
+		return reference_count_;
+	}
+
+	[[nodiscard]] void* allocate(std::size_t size, std::size_t align){
+		return resource_.allocate(size, align);
+	}
+
+	void deallocate(void* p, std::size_t size, std::size_t align) noexcept{
+		resource_.deallocate(p, size, align);
+	}
+};
+
+/**
+ * @brief Where a node's memory comes from, never transferred by copy or move as it belongs to the storage.
+ */
+struct node_allocation{
+	node_arena* arena{};
+	std::size_t size{};
+	std::size_t align{};
+
+	[[nodiscard]] node_allocation() = default;
+
+	node_allocation(const node_allocation&) noexcept{
+	}
+
+	node_allocation& operator=(const node_allocation&) noexcept{
+		return *this;
+	}
+
+	void assign(node_arena* arena, std::size_t size, std::size_t align) noexcept{
+		this->arena = arena;
+		this->size = size;
+		this->align = align;
+	}
+};
+
+/**
+ * @brief Bookkeeping of one node instance, never transferred by copy or move, the target keeps its own value.
+ */
+template <typename T, T initial = T{}>
+struct instance_state{
+	T value{initial};
+
+	[[nodiscard]] instance_state() = default;
+
+	instance_state(const instance_state&) noexcept{
+	}
+
+	instance_state& operator=(const instance_state&) noexcept{
+		return *this;
+	}
+};
+
 export
 struct node_pointer{
 private:
@@ -62,6 +162,13 @@ public:
 		incr_();
 	}
 
+	/**
+	 * @brief Construct the node in the arena, the memory is returned to it when the last reference is released.
+	 */
+	template <typename T, typename... Args>
+		requires std::constructible_from<T, Args&&...>
+	[[nodiscard]] static node_pointer make_in_arena(node_arena& arena, Args&&... args);
+
 	constexpr inline ~node_pointer(){
 		if(node_) decr_();
 	}
@@ -172,8 +279,96 @@ struct successor_entry{
 	void mark_updated() const;
 };
 
+/**
+ * @brief Thread local state of a push propagation, used by propagate_type::topological nodes.
+ *
+ * Nodes staged during the propagation are kept in a min heap ordered by topological rank,
+ * the outermost push drains it so every scheduled node is evaluated exactly once, after all of its predecessors.
+ */
+struct propagation_batch{
+	unsigned depth{};
+	//when non-zero, eager modifiers are staged like topological ones, see manager::transaction
+	unsigned coalescing{};
+	std::vector<node_pointer> scheduled{};
+
+	void schedule(node& node);
+
+	void drain();
+
+	void abort() noexcept;
+
+private:
+	static bool rank_greater(const node_pointer& lhs, const node_pointer& rhs) noexcept;
+};
+
+thread_local propagation_batch current_propagation_batch{};
+
+//bumped on every new edge or propagate type change, invalidates cached parallel fan-out checks
+std::atomic<std::uint64_t> topology_version{1};
+
+/**
+ * @brief State of the open update transactions of one manager on this thread, see manager::transaction
+ */
+struct update_transaction_state{
+	const manager* owner{};
+	unsigned depth{};
+	std::vector<node_pointer> dirty{};
+};
+
+//one entry per manager with an open transaction, a transaction never defers the sources of another manager
+thread_local std::vector<update_transaction_state> current_update_transactions{};
+
+update_transaction_state* find_update_transaction(const manager& owner) noexcept{
+	const auto itr = std::ranges::find(current_update_transactions, std::addressof(owner), &update_transaction_state::owner);
+	return itr == current_update_transactions.end() ? nullptr : std::to_address(itr);
+}
+
+/**
+ * @brief Thread local state of a pull (fetch), shared by all nested requests of one top-level request.
+ *
+ * Uncached nodes reached by more than one path memoize their result inside the scope,
+ * the memos are released when the outermost scope ends.
+ */
+struct fetch_scope_state{
+	unsigned depth{};
+	std::vector<node*> memoized{};
+
+	void release() noexcept;
+};
+
+thread_local fetch_scope_state current_fetch_scope{};
+
+struct fetch_scope{
+	[[nodiscard]] fetch_scope() noexcept{
+		++current_fetch_scope.depth;
+	}
+
+	~fetch_scope(){
+		fetch_scope_state& state = current_fetch_scope;
+		if(--state.depth == 0 && !state.memoized.empty()){
+			state.release();
+		}
+	}
+
+	fetch_scope(const fetch_scope& other) = delete;
+	fetch_scope(fetch_scope&& other) noexcept = delete;
+	fetch_scope& operator=(const fetch_scope& other) = delete;
+	fetch_scope& operator=(fetch_scope&& other) noexcept = delete;
+
+	/**
+	 * @brief whether the current scope is opened inside another fetch, i.e. the result may be requested again
+	 */
+	[[nodiscard]] static bool is_nested() noexcept{
+		return current_fetch_scope.depth > 1;
+	}
+
+	static void register_memoized(node& node){
+		current_fetch_scope.memoized.push_back(std::addressof(node));
+	}
+};
+
 template <typename Rng, typename T>
-void push_to_successors(Rng&& range, data_carrier<T>&& data){
+void push_to_successors_impl(Rng&& range, data_carrier<T>&& data){
 	if constexpr(data_carrier<T>::is_trivial){
 		for(const successor_entry& e : range){
 			e.update(std::move(data));
@@ -219,6 +414,89 @@ void push_to_successors(Rng&& range, data_carrier<T>&& data){
 	}
 }
 
+template <typename Rng, typename T>
+void push_to_successors(Rng&& range, data_carrier<T>&& data){
+	propagation_batch& batch = current_propagation_batch;
+	++batch.depth;
+
+	try{
+		react_flow::push_to_successors_impl(std::forward<Rng>(range), std::move(data));
+	} catch(...){
+		batch.abort();
+		throw;
+	}
+
+	if(--batch.depth == 0 && !batch.scheduled.empty()){
+		batch.drain();
+	}
+}
+
+/**
+ * @brief Run a parallel fan-out job with fresh thread local propagation states.
+ *
+ * A job may be executed by a thread helping inside its own propagation, its states must neither leak in nor out.
+ */
+struct isolated_propagation_context{
+private:
+	propagation_batch batch_;
+	fetch_scope_state fetch_;
+	std::vector<update_transaction_state> transactions_;
+
+public:
+	[[nodiscard]] explicit isolated_propagation_context(unsigned coalescing) noexcept
+		: batch_(std::exchange(current_propagation_batch, propagation_batch{.coalescing = coalescing})),
+		fetch_(std::exchange(current_fetch_scope, {})),
+		transactions_(std::exchange(current_update_transactions, {})){
+	}
+
+	~isolated_propagation_context(){
+		current_propagation_batch = std::move(batch_);
+		current_fetch_scope = std::move(fetch_);
+		current_update_transactions = std::move(transactions_);
+	}
+
+	isolated_propagation_context(const isolated_propagation_context& other) = delete;
+	isolated_propagation_context(isolated_propagation_context&& other) noexcept = delete;
+	isolated_propagation_context& operator=(const isolated_propagation_context& other) = delete;
+	isolated_propagation_context& operator=(isolated_propagation_context&& other) noexcept = delete;
+};
+
+/**
+ * @brief Every successor gets its own carrier (copies, the last one takes the moved data) and runs on the fork-join pool.
+ */
+template <typename Rng, typename T>
+void push_to_successors_parallel(Rng&& range, data_carrier<T>&& data){
+	const std::span<const successor_entry> entries{range};
+
+	std::vector<data_carrier<T>> carriers;
+	carriers.reserve(entries.size());
+	for(std::size_t i = 1; i < entries.size(); ++i){
+		carriers.emplace_back(std::as_const(data));
+	}
+	carriers.push_back(std::move(data));
+
+	auto job = [&, coalescing = current_propagation_batch.coalescing](std::size_t index){
+		isolated_propagation_context context{coalescing};
+		react_flow::push_to_successors(entries.subspan(index, 1), std::move(carriers[index]));
+	};
+
+	fork_join_pool::instance().run(entries.size(), job);
+}
+
+bool is_parallel_fan_out_ready(const node& source);
+
+template <typename Rng, typename T>
+void push_to_successors(const node& source, Rng&& range, data_carrier<T>&& data){
+	if constexpr(std::is_copy_constructible_v<data_carrier<T>>){
+		if(react_flow::is_parallel_fan_out_ready(source)){
+			react_flow::push_to_successors_parallel(std::forward<Rng>(range), std::move(data));
+			return;
+		}
+	}
+
+	react_flow::push_to_successors(std::forward<Rng>(range), std::move(data));
+}
+
 /**
  * @brief 判断在 n0 的 output 中加入 n1 后是否会形成环
  *
@@ -229,14 +507,199 @@ void push_to_successors(Rng&& range, data_carrier<T>&& data){
 export
 bool is_ring_bridge(const node* self, const node* successors);
 
+/**
+ * @brief Whether per-node counters, timing and trace recording are compiled in, see MO_YANXI_DATA_FLOW_ENABLE_PROFILING
+ */
+export constexpr inline bool profiling_enabled = MO_YANXI_DATA_FLOW_ENABLE_PROFILING;
+
+export
+struct node_profile{
+	/**
+	 * @brief pushes received from predecessors
+	 */
+	std::uint64_t pushes{};
+
+	/**
+	 * @brief requests (fetch) served to successors
+	 */
+	std::uint64_t pulls{};
+
+	/**
+	 * @brief requests served from the cache or the fetch memo without computation
+	 */
+	std::uint64_t cache_hits{};
+
+	/**
+	 * @brief invocations of the node function
+	 */
+	std::uint64_t recomputations{};
+
+	/**
+	 * @brief time spent handling pushes and requests, including upstream and downstream work they triggered
+	 */
+	std::chrono::nanoseconds total_time{};
+
+	/**
+	 * @brief time spent in the node function only
+	 */
+	std::chrono::nanoseconds self_time{};
+};
+
+struct trace_event{
+	const node* owner;
+	const char* category;
+	std::thread::id thread;
+	std::chrono::steady_clock::time_point begin;
+	std::chrono::nanoseconds duration;
+};
+
+/**
+ * @brief Process wide trace buffer, recording is toggled by manager::begin_trace / end_trace
+ */
+struct trace_recorder{
+	std::atomic<bool> recording{};
+	std::mutex mutex{};
+	std::chrono::steady_clock::time_point origin{};
+	std::vector<trace_event> events{};
+
+	static trace_recorder& instance() noexcept{
+		static trace_recorder recorder{};
+		return recorder;
+	}
+
+	void record(const trace_event& event){
+		std::lock_guard _{mutex};
+		events.push_back(event);
+	}
+};
+
+/**
+ * @brief Scoped timer adding to a node_profile field and recording a trace event, empty when profiling is disabled
+ */
+struct profile_timer{
+private:
+	struct state{
+		node* owner;
+		std::chrono::nanoseconds node_profile::* field;
+		const char* category;
+		std::chrono::steady_clock::time_point begin;
+	};
+
+	ADAPTED_NO_UNIQUE_ADDRESS optional_val<state, profiling_enabled> state_{};
+
+public:
+	[[nodiscard]] profile_timer(node& owner, std::chrono::nanoseconds node_profile::* field, const char* category) noexcept;
+
+	~profile_timer();
+
+	profile_timer(const profile_timer& other) = delete;
+	profile_timer(profile_timer&& other) noexcept = delete;
+	profile_timer& operator=(const profile_timer& other) = delete;
+	profile_timer& operator=(profile_timer&& other) noexcept = delete;
+};
+
+/**
+ * @brief Clock shared by pulse nodes, a tick only visits nodes that received data since the last tick.
+ *
+ * Created by manager::add_pulse_group, nodes join the default group (ticked on every manager::update) when added.
+ */
+export
+struct pulse_group{
+	friend manager;
+	friend node;
+
+private:
+	std::string name_;
+	std::chrono::nanoseconds period_;
+	std::chrono::steady_clock::time_point next_tick_{};
+
+	//dirty list, each node is queued at most once, see node::request_pulse
+	std::vector<node*> pending_{};
+	std::vector<node*> ticking_{};
+
+	[[nodiscard]] bool consume_tick(std::chrono::steady_clock::time_point now) noexcept{
+		if(period_ <= std::chrono::nanoseconds::zero()) return true;
+		if(now < next_tick_) return false;
+
+		next_tick_ += period_;
+		//fallen behind more than a period, skip the missed ticks
+		if(next_tick_ <= now) next_tick_ = now + period_;
+		return true;
+	}
+
+	void erase_pending(const node& node) noexcept{
+		std::erase(pending_, &node);
+		std::ranges::replace(ticking_, &node, nullptr);
+	}
+
+public:
+	[[nodiscard]] explicit pulse_group(std::string_view name, std::chrono::nanoseconds period = {})
+		: name_(name), period_(period){
+	}
+
+	[[nodiscard]] std::string_view get_name() const noexcept{
+		return name_;
+	}
+
+	[[nodiscard]] std::chrono::nanoseconds get_period() const noexcept{
+		return period_;
+	}
+
+	/**
+	 * @brief Zero or negative period ticks on every manager::update
+	 */
+	void set_period(std::chrono::nanoseconds period) noexcept{
+		period_ = period;
+		next_tick_ = {};
+	}
+
+	[[nodiscard]] std::size_t get_pending_count() const noexcept{
+		return pending_.size();
+	}
+};
+
+struct node_registry;
+
 struct node{
 	friend successor_entry;
 	friend manager;
+	friend node_registry;
 	friend node_pointer;
+	friend propagation_batch;
+	friend fetch_scope_state;
+	friend bool is_parallel_fan_out_ready(const node&);
 	friend bool is_ring_bridge(const node*, const node*);
+	friend bool is_reachable(const node*, const node*, std::uint32_t);
+	friend profile_timer;
 
 private:
 	exchange_on_move<unsigned> reference_count_{};
+	node_allocation allocation_{};
+
+	ADAPTED_NO_UNIQUE_ADDRESS optional_val<node_profile, profiling_enabled> profile_{};
+	ADAPTED_NO_UNIQUE_ADDRESS optional_val<std::string, profiling_enabled> profile_name_{};
+
+	/**
+	 * @brief Longest path from a source, maintained on connection. Every edge satisfies rank(prev) < rank(post).
+	 */
+	std::uint32_t topological_rank_{};
+	instance_state<bool> topological_scheduled_{};
+
+	bool parallel_fan_out_{};
+	mutable bool parallel_fan_out_safe_{};
+	mutable std::uint64_t parallel_checked_version_{};
+
+	//mark of the last reachability search visited this node, see is_ring_bridge
+	mutable std::uint64_t visit_epoch_{};
+
+	//membership of the group pending list, a moved node joins a group again when added to a manager
+	instance_state<pulse_group*> pulse_group_{};
+	instance_state<bool> pulse_queued_{};
+
+	//slot in the registry of the owning manager, see node_registry
+	instance_state<std::uint32_t, std::numeric_limits<std::uint32_t>::max()> registry_slot_{};
+	//queued for removal on the next manager::update
+	instance_state<bool> expired_{};
 
 
 protected:
@@ -251,7 +714,9 @@ public:
 	}
 
 
-	virtual ~node() = default;
+	virtual ~node(){
+		if(pulse_queued_.value) pulse_group_.value->erase_pending(*this);
+	}
 
 	node(const node& other) = delete;
 	node(node&& other) noexcept = default;
@@ -296,18 +761,116 @@ public:
 		return reference_count_.value;
 	}
 
+	[[nodiscard]] node_arena* get_arena() const noexcept{
+		return allocation_.arena;
+	}
+
 	[[nodiscard]] propagate_type get_propagate_type() const noexcept{
 		return data_propagate_type_;
 	}
 
 	void set_propagate_type(propagate_type type) noexcept{
+		if(data_propagate_type_ == type) return;
 		data_propagate_type_ = type;
+		//pulse nodes are not parallel safe, force parallel fan-out sources to check again
+		topology_version.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	[[nodiscard]] pulse_group* get_pulse_group() const noexcept{
+		return pulse_group_.value;
+	}
+
+	/**
+	 * @brief Move the node to another clock, data waiting for a pulse is delivered on the next tick of the new group
+	 */
+	void set_pulse_group(pulse_group& group){
+		if(pulse_group_.value == &group) return;
+		if(pulse_queued_.value){
+			pulse_group_.value->erase_pending(*this);
+			group.pending_.push_back(this);
+		}
+		pulse_group_.value = &group;
 	}
 
 	[[nodiscard]] bool is_data_expired() const noexcept{
 		return data_pending_state_ != data_pending_state::done;
 	}
 
+	[[nodiscard]] std::uint32_t get_topological_rank() const noexcept{
+		return topological_rank_;
+	}
+
+	[[nodiscard]] bool is_parallel_fan_out() const noexcept{
+		return parallel_fan_out_;
+	}
+
+	/**
+	 * @brief Push to successors in parallel on the fork-join pool, joined before the push returns.
+	 *
+	 * Only applied when the subgraphs below the successors are disjoint and never read each other, and the node
+	 * serves a stable value to them (providers and cached outputs), otherwise the push falls back to sequential. Nodes in these subgraphs (listeners included) are then invoked
+	 * from pool threads.
+	 */
+	void set_parallel_fan_out(bool parallel) noexcept{
+		parallel_fan_out_ = parallel;
+		parallel_checked_version_ = 0;
+	}
+
+	/**
+	 * @brief Counters of the node, always empty unless profiling_enabled
+	 */
+	[[nodiscard]] node_profile get_profile() const noexcept{
+		if constexpr(profiling_enabled){
+			return *profile_;
+		} else{
+			return {};
+		}
+	}
+
+	void reset_profile() noexcept{
+		if constexpr(profiling_enabled){
+			*profile_ = {};
+		}
+	}
+
+	/**
+	 * @brief Label used by manager::stats and trace export, ignored unless profiling_enabled
+	 */
+	void set_profile_name(std::string_view name){
+		if constexpr(profiling_enabled){
+			*profile_name_ = name;
+		}
+	}
+
+	[[nodiscard]] std::string_view get_profile_name() const noexcept{
+		if constexpr(profiling_enabled){
+			return *profile_name_;
+		} else{
+			return {};
+		}
+	}
+
+	/**
+	 * @brief Whether the node must only be touched from the manager thread, e.g. it dispatches to the manager.
+	 */
+	[[nodiscard]] virtual bool requires_manager_thread() const noexcept{
+		return false;
+	}
+
+	/**
+	 * @brief Whether requests only read a value kept by the node, so successors may pull it from several threads at once.
+	 */
+	[[nodiscard]] virtual bool serves_stable_value() const noexcept{
+		return false;
+	}
+
+protected:
+	FORCE_INLINE void profile_count(std::uint64_t node_profile::* counter) noexcept{
+		if constexpr(profiling_enabled){
+			++((*profile_).*counter);
+		}
+	}
+
 #pragma region ConncectionInterface
 
 public:
@@ -340,6 +903,8 @@ public:
 	bool connect_successors_unchecked(const std::size_t slot_of_successor, node& post){
 		if(connect_successors_impl(slot_of_successor, post)){
 			post.connect_predecessor_impl(slot_of_successor, *this);
+			raise_topological_rank(post);
+			topology_version.fetch_add(1, std::memory_order_relaxed);
 			return true;
 		}
 		return false;
@@ -433,6 +998,12 @@ public:
 	virtual void set_manager(manager& manager){
 	}
 
+	/**
+	 * @brief Called on the manager thread when the node leaves its manager, e.g. the manager is destroyed before the node
+	 */
+	virtual void reset_manager() noexcept{
+	}
+
 	[[nodiscard]] virtual bool is_isolated() const noexcept{
 		return false;
 	}
@@ -455,6 +1026,15 @@ public:
 	virtual void rebind_successor_reference(std::size_t slot, raw_node_ptr from, raw_node_ptr to) noexcept{
 	}
 
+private:
+	/**
+	 * @brief Keep rank(prev) < rank(post) after a new edge, ranks are never lowered on disconnection.
+	 *
+	 * Raises every reachable node whose rank is too low instead of reordering the affected region,
+	 * so building a chain back to front walks the whole tail on each connection and is quadratic.
+	 */
+	void raise_topological_rank(node& post);
+
 protected:
 	//TODO disconnected conflicted
 	virtual bool connect_successors_impl(std::size_t slot, node& post){
@@ -475,6 +1055,60 @@ public:
 		return;
 	}
 
+protected:
+	/**
+	 * @brief Queue the node in its pulse group, called when the node enters data_pending_state::waiting_pulse
+	 */
+	void request_pulse(){
+		if(pulse_queued_.value || !pulse_group_.value) return;
+		pulse_group_.value->pending_.push_back(this);
+		pulse_queued_.value = true;
+	}
+
+	/**
+	 * @brief Called once per propagation for topological nodes, after all scheduled predecessors are evaluated.
+	 */
+	virtual void evaluate_staged(){
+	}
+
+	void schedule_staged_evaluation(){
+		current_propagation_batch.schedule(*this);
+	}
+
+	/**
+	 * @brief The propagate type actually applied on push, eager nodes are staged during a transaction commit.
+	 */
+	[[nodiscard]] propagate_type get_push_propagate_type() const noexcept{
+		if(data_propagate_type_ == propagate_type::eager && current_propagation_batch.coalescing){
+			return propagate_type::topological;
+		}
+		return data_propagate_type_;
+	}
+
+	/**
+	 * @brief Defer an eager push of a source node until the open transaction of its manager commits.
+	 * @return false if no transaction of owner is open
+	 */
+	bool defer_to_transaction(const manager* owner){
+		if(current_update_transactions.empty() || owner == nullptr) return false;
+		update_transaction_state* state = react_flow::find_update_transaction(*owner);
+		if(state == nullptr) return false;
+
+		if(data_pending_state_ != data_pending_state::expired){
+			state->dirty.emplace_back(*this);
+			data_pending_state_ = data_pending_state::expired;
+		}
+		return true;
+	}
+
+	/**
+	 * @brief Release the result memoized during a fetch scope.
+	 */
+	virtual void clear_fetch_memo() noexcept{
+	}
+
+public:
+
 	/**
 	 *
 	 * @brief Only notify the data has changed, used for lazy nodes. Should be mutually exclusive with update when propagated.
@@ -705,10 +1339,38 @@ constexpr void node_pointer::incr_() const noexcept{
 constexpr void node_pointer::decr_() const noexcept{
 	if(node_->decr_ref()){
 		node_->disconnect_self_from_context();
-		delete node_;
+
+		if(node_arena* arena = node_->allocation_.arena){
+			const std::size_t size = node_->allocation_.size;
+			const std::size_t align = node_->allocation_.align;
+			void* storage = dynamic_cast<void*>(node_);
+			node_->~node();
+			arena->deallocate(storage, size, align);
+			arena->decr_ref();
+		} else{
+			delete node_;
+		}
 	}
 }
 
+template <typename T, typename... Args>
+	requires std::constructible_from<T, Args&&...>
+node_pointer node_pointer::make_in_arena(node_arena& arena, Args&&... args){
+	void* storage = arena.allocate(sizeof(T), alignof(T));
+
+	T* ptr;
+	try{
+		ptr = ::new(storage) T(std::forward<Args>(args)...);
+	} catch(...){
+		arena.deallocate(storage, sizeof(T), alignof(T));
+		throw;
+	}
+
+	static_cast<node&>(*ptr).allocation_.assign(std::addressof(arena), sizeof(T), alignof(T));
+	arena.incr_ref();
+	return node_pointer{ptr};
+}
+
 
 template <typename T>
 void successor_entry::update(data_carrier<T>&& data) const{
@@ -717,6 +1379,10 @@ void successor_entry::update(data_carrier<T>&& data) const{
 	assert(unstable_type_identity_of<T>() == idx);
 #endif
 
+	if constexpr(profiling_enabled){
+		++(*entity->profile_).pushes;
+	}
+	profile_timer _{*entity, &node_profile::total_time, "push"};
 	push_fp(*entity.get(), index, std::move(data));
 }
 
@@ -735,6 +1401,10 @@ void successor_entry::update(data_carrier_obj&& data, data_type_index checker) c
 		throw invalid_node_error{"Type Mismatch on update"};
 	}
 #endif
+	if constexpr(profiling_enabled){
+		++(*entity->profile_).pushes;
+	}
+	profile_timer _{*entity, &node_profile::total_time, "push"};
 	push_fp(*entity.get(), index, std::move(data));
 }
 
@@ -742,28 +1412,208 @@ void successor_entry::mark_updated() const{
 	entity->mark_updated(index);
 }
 
-#pragma endregion
+inline profile_timer::profile_timer(node& owner, std::chrono::nanoseconds node_profile::* field, const char* category) noexcept{
+	if constexpr(profiling_enabled){
+		*state_ = state{std::addressof(owner), field, category, std::chrono::steady_clock::now()};
+	}
+}
 
-#pragma region Topology
+inline profile_timer::~profile_timer(){
+	if constexpr(profiling_enabled){
+		const state& s = *state_;
+		const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - s.begin);
+		(*s.owner->profile_).*s.field += duration;
+
+		if(auto& recorder = trace_recorder::instance(); recorder.recording.load(std::memory_order_relaxed)){
+			try{
+				recorder.record({s.owner, s.category, std::this_thread::get_id(), s.begin, duration});
+			} catch(...){
+				//drop the event, tracing must never break propagation
+			}
+		}
+	}
+}
 
-bool is_reachable(const node* start_node, const node* target_node, std::unordered_set<const node*>& visited){
-	if(start_node == nullptr) return false;
-	if(start_node == target_node){
-		return true;
+bool propagation_batch::rank_greater(const node_pointer& lhs, const node_pointer& rhs) noexcept{
+	return lhs->topological_rank_ > rhs->topological_rank_;
+}
+
+void propagation_batch::schedule(node& node){
+	if(node.topological_scheduled_.value) return;
+
+	scheduled.emplace_back(node);
+	node.topological_scheduled_.value = true;
+	std::ranges::push_heap(scheduled, rank_greater);
+}
+
+void propagation_batch::drain(){
+	//keep the batch open, pushes during evaluation only schedule successors
+	++depth;
+
+	try{
+		while(!scheduled.empty()){
+			std::ranges::pop_heap(scheduled, rank_greater);
+			const node_pointer next = std::move(scheduled.back());
+			scheduled.pop_back();
+
+			next->topological_scheduled_.value = false;
+			profile_timer _{*next, &node_profile::total_time, "evaluate"};
+			next->evaluate_staged();
+		}
+	} catch(...){
+		abort();
+		throw;
 	}
 
-	visited.insert(start_node);
+	--depth;
+}
 
-	for(const node* neighbor : start_node->get_inputs()){
-		if(neighbor){
-			if(!visited.contains(neighbor)){
-				if(is_reachable(neighbor, target_node, visited)){
-					return true;
+/**
+ * @brief Successor subgraphs are pairwise disjoint and only read from themselves or the source.
+ *
+ * Pulse nodes are rejected as well, they queue themselves into the pending list shared by their group.
+ * Branches may only read the source itself if it serves a stable value, see node::serves_stable_value.
+ */
+bool check_parallel_fan_out(const node& source){
+	std::unordered_map<const node*, std::size_t> owners;
+	std::vector<const node*> stack;
+
+	const auto outputs = source.get_outputs();
+	for(std::size_t i = 0; i < outputs.size(); ++i){
+		const node* root = outputs[i].get();
+		if(!owners.try_emplace(root, i).second) return false;
+
+		stack.push_back(root);
+		while(!stack.empty()){
+			const node* cur = stack.back();
+			stack.pop_back();
+			if(cur->requires_manager_thread() || cur->get_propagate_type() == propagate_type::pulse) return false;
+
+			for(const successor_entry& e : cur->get_outputs()){
+				if(const auto [itr, inserted] = owners.try_emplace(e.get(), i); !inserted){
+					if(itr->second != i) return false;
+				} else{
+					stack.push_back(e.get());
 				}
 			}
 		}
 	}
 
+	for(const auto& [n, index] : owners){
+		for(const node* input : n->get_inputs()){
+			if(input == nullptr) continue;
+			//every branch pulls the source concurrently, an uncached source would memoize its result on each thread
+			if(input == std::addressof(source)){
+				if(source.serves_stable_value()) continue;
+				return false;
+			}
+			if(const auto itr = owners.find(input); itr == owners.end() || itr->second != index) return false;
+		}
+	}
+
+	return true;
+}
+
+bool is_parallel_fan_out_ready(const node& source){
+	if(!source.parallel_fan_out_ || source.get_outputs().size() < 2) return false;
+
+	if(const auto version = topology_version.load(std::memory_order_relaxed); source.parallel_checked_version_ != version){
+		source.parallel_fan_out_safe_ = react_flow::check_parallel_fan_out(source);
+		source.parallel_checked_version_ = version;
+	}
+
+	return source.parallel_fan_out_safe_;
+}
+
+void fetch_scope_state::release() noexcept{
+	for(node* n : memoized){
+		n->clear_fetch_memo();
+	}
+	memoized.clear();
+}
+
+void propagation_batch::abort() noexcept{
+	if(--depth != 0) return;
+
+	for(const node_pointer& n : scheduled){
+		n->topological_scheduled_.value = false;
+	}
+	scheduled.clear();
+}
+
+#pragma endregion
+
+#pragma region Topology
+
+/**
+ * @brief Forward search state of ring check and rank raising, reused to avoid allocation per connection.
+ */
+struct reachability_search{
+	std::vector<const node*> stack{};
+};
+
+thread_local reachability_search current_reachability_search{};
+
+//shared by all threads so marks left by a search on another thread never collide
+std::atomic<std::uint64_t> reachability_epoch{};
+
+void node::raise_topological_rank(node& post){
+	if(post.topological_rank_ > topological_rank_) return;
+	post.topological_rank_ = topological_rank_ + 1;
+
+	auto& stack = current_reachability_search.stack;
+	stack.clear();
+	stack.push_back(std::addressof(post));
+
+	while(!stack.empty()){
+		const node* cur = stack.back();
+		stack.pop_back();
+
+		for(const successor_entry& e : cur->get_outputs()){
+			node* next = e.get();
+			//only reachable when ring check is disabled, give up ordering instead of looping forever
+			if(next == this){
+				stack.clear();
+				return;
+			}
+
+			if(next->topological_rank_ <= cur->topological_rank_){
+				next->topological_rank_ = cur->topological_rank_ + 1;
+				stack.push_back(next);
+			}
+		}
+	}
+}
+
+/**
+ * @brief Whether target is reachable from start through outputs, only visit nodes whose rank is lower than the bound.
+ */
+bool is_reachable(const node* start_node, const node* target_node, std::uint32_t rank_bound){
+	const std::uint64_t epoch = reachability_epoch.fetch_add(1, std::memory_order_relaxed) + 1;
+	auto& stack = current_reachability_search.stack;
+	stack.clear();
+
+	start_node->visit_epoch_ = epoch;
+	stack.push_back(start_node);
+
+	while(!stack.empty()){
+		const node* cur = stack.back();
+		stack.pop_back();
+
+		for(const successor_entry& e : cur->get_outputs()){
+			const node* next = e.get();
+			if(next == target_node){
+				stack.clear();
+				return true;
+			}
+
+			//every node reaching the target has a lower rank than it
+			if(next->topological_rank_ >= rank_bound || next->visit_epoch_ == epoch) continue;
+			next->visit_epoch_ = epoch;
+			stack.push_back(next);
+		}
+	}
+
 	return false;
 }
 
@@ -772,8 +1622,12 @@ bool is_ring_bridge(const node* self, const node* successors){
 		return true;
 	}
 
-	std::unordered_set<const node*> visited;
-	return is_reachable(self, successors, visited);
+	if(self == nullptr || successors == nullptr) return false;
+
+	//rank(prev) < rank(post) holds on every edge, a path from successors back to self is impossible
+	if(successors->topological_rank_ > self->topological_rank_) return false;
+
+	return is_reachable(successors, self, self->topological_rank_);
 }
 
 #pragma endregion
@@ -22,6 +22,15 @@ namespace mo_yanxi::react_flow{
 		bool success;
 	};
 
+	template <typename T>
+	struct fetch_memo{
+		data_carrier<T> value;
+		bool expired;
+	};
+
+	template <typename Stage, bool head, bool tail>
+	struct static_stage;
+
 
 	template <typename Impl, typename Ret, typename... Args>
 		requires (spec_of_descriptor<Ret> && (spec_of_descriptor<Args> && ...))
@@ -76,6 +85,13 @@ namespace mo_yanxi::react_flow{
 		ADAPTED_NO_UNIQUE_ADDRESS expire_flags<descriptor_trait<Args>::cached...> expired_flags_{};
 		ADAPTED_NO_UNIQUE_ADDRESS optional_val<data_state, descriptor_trait<Ret>::cached> data_state_{};
 
+		//inputs pushed in topological mode, cached inputs are staged in their descriptor directly
+		ADAPTED_NO_UNIQUE_ADDRESS std::tuple<optional_val<std::optional<typename descriptor_trait<Args>::input_pass_type>, !descriptor_trait<Args>::cached>...> staged_inputs_{};
+		ADAPTED_NO_UNIQUE_ADDRESS optional_val<trigger_type, has_trigger> staged_trigger_{};
+
+		//result shared by all paths of one fetch, see fetch_scope
+		ADAPTED_NO_UNIQUE_ADDRESS optional_val<std::optional<fetch_memo<return_output_type>>, !descriptor_trait<Ret>::cached> fetch_memo_{};
+
 	public:
 		using type_aware_node<return_output_type>::type_aware_node;
 
@@ -160,6 +176,7 @@ namespace mo_yanxi::react_flow{
 
 	public:
 		bool pull_and_push(bool allow_expired) override {
+			fetch_scope scope{};
 			auto [arguments, state, success] = this->load_arguments<true>(trigger_type::active, allow_expired, nullptr);
 			if(success) {
 				// 更新挂起状态为已完成
@@ -171,6 +188,11 @@ namespace mo_yanxi::react_flow{
 			return false;
 		}
 
+		[[nodiscard]] bool serves_stable_value() const noexcept override{
+			//cache hits are still counted when profiling
+			return descriptor_trait<Ret>::cached && !profiling_enabled;
+		}
+
 		[[nodiscard]] data_state get_data_state() const noexcept override{
 			if constexpr(descriptor_trait<Ret>::cached){
 				return *data_state_;
@@ -217,8 +239,11 @@ namespace mo_yanxi::react_flow{
 		}
 
 		void store_result(return_pass_type&& rst){
+			//unchanged output of a distinct descriptor, successors are already up to date
+			if(!ret_descriptor_.check_changed(rst)) return;
+
 			data_carrier<return_output_type> v = ret_descriptor_ << std::move(rst);
-			react_flow::push_to_successors(successors_, std::move(v));
+			react_flow::push_to_successors(*this, successors_, std::move(v));
 		}
 
 		void on_pulse_received(manager& m) override{
@@ -268,7 +293,7 @@ namespace mo_yanxi::react_flow{
 				trigger = trigger_type::active;
 			}
 
-			switch(this->get_propagate_type()){
+			switch(this->get_push_propagate_type()){
 			case propagate_type::eager : this->update(trigger, [&]<std::size_t J>(argument_pass_type& arguments){
 					if constexpr(J == I){
 						using Ty = std::tuple_element_t<I, input_descriptors>;
@@ -285,11 +310,105 @@ namespace mo_yanxi::react_flow{
 				break;
 			case propagate_type::pulse : update_cache();
 				this->data_pending_state_ = data_pending_state::waiting_pulse;
+				this->request_pulse();
+				break;
+			case propagate_type::topological :
+				if constexpr(!(has_trigger && I == trigger_index)){
+					using Ty = std::tuple_element_t<I, input_descriptors>;
+					if constexpr(descriptor_trait<Ty>::cached){
+						update_cache();
+					} else{
+						using InputTy = typename descriptor_trait<Ty>::input_type;
+						*std::get<I>(staged_inputs_) = std::move(data_carrier_cast<InputTy>(in_data));
+					}
+				}
+				staged_trigger_ = trigger;
+				this->schedule_staged_evaluation();
 				break;
 			default : std::unreachable();
 			}
 		}
 
+		void evaluate_staged() override{
+			trigger_type trigger = trigger_type::active;
+			if constexpr(has_trigger){
+				trigger = *staged_trigger_;
+			}
+
+			this->update(trigger, [this]<std::size_t J>(argument_pass_type& arguments){
+				using Ty = std::tuple_element_t<J, input_descriptors>;
+				if constexpr(!descriptor_trait<Ty>::cached){
+					if(auto& staged = *std::get<J>(staged_inputs_)){
+						std::get<J>(arguments) = std::get<J>(arguments_) << std::move(*staged);
+						staged.reset();
+						return true;
+					}
+				}
+				return false;
+			});
+		}
+
+		void clear_fetch_memo() noexcept override{
+			if constexpr(!descriptor_trait<Ret>::cached){
+				(*fetch_memo_).reset();
+			}
+		}
+
+		/**
+		 * @brief Shared request implementation of synchronous modifiers, computes the result from inputs.
+		 *
+		 * When uncached and requested inside another fetch by more than one successor,
+		 * the result is computed once and reused until the outermost fetch ends.
+		 */
+		request_pass_handle<return_output_type> request_from_inputs(bool allow_expired){
+			this->profile_count(&node_profile::pulls);
+
+			if constexpr(descriptor_trait<Ret>::cached){
+				auto state = this->get_data_state();
+				if(state == data_state::fresh || (state == data_state::expired && allow_expired)){
+					this->profile_count(&node_profile::cache_hits);
+					return react_flow::make_request_handle_expected_from_data_storage(this->get_cache(),
+						state == data_state::expired);
+				}
+			} else{
+				if(const auto& memo = *fetch_memo_; memo && (!memo->expired || allow_expired)){
+					this->profile_count(&node_profile::cache_hits);
+					return react_flow::make_request_handle_expected_ref(memo->value.get_ref_view(), memo->expired);
+				}
+			}
+
+			profile_timer timer{*this, &node_profile::total_time, "pull"};
+			fetch_scope scope{};
+			auto [arguments, state, success] = this->template load_arguments<true>(trigger_type::active, allow_expired,
+				nullptr);
+
+			if(!success){
+				return make_request_handle_unexpected<return_output_type>(data_state::failed);
+			}
+
+			data_carrier<return_output_type> result = ret_descriptor_ << this->invoke_apply(arguments);
+			const bool expired = state == data_state::expired;
+
+			if constexpr(!descriptor_trait<Ret>::cached){
+				if(fetch_scope::is_nested() && successors_.size() > 1){
+					fetch_scope::register_memoized(*this);
+					const auto& memo = (*fetch_memo_).emplace(std::move(result), expired);
+					return react_flow::make_request_handle_expected_ref(memo.value.get_ref_view(), expired);
+				}
+			}
+
+			return react_flow::make_request_handle_expected_from_data_storage(std::move(result), expired);
+		}
+
+		/**
+		 * @brief Invoke the node function of Impl, counted and timed as self time when profiling
+		 */
+		FORCE_INLINE return_pass_type invoke_apply(argument_pass_type& arguments){
+			this->profile_count(&node_profile::recomputations);
+			profile_timer timer{*this, &node_profile::self_time, "self"};
+			return static_cast<Impl*>(this)->apply(arguments);
+		}
+
 		FORCE_INLINE bool has_cache_at(std::size_t index) const noexcept{
 			return expired_flags_.has_bit(index);
 		}
@@ -368,6 +487,7 @@ namespace mo_yanxi::react_flow{
 
 	private:
 		FORCE_INLINE void update(trigger_type trigger, auto checker){
+			fetch_scope scope{};
 			auto [arguments, state, success] = this->load_arguments(trigger, true, std::move(checker));
 
 			if(successors_.empty() || !success) return;
@@ -399,25 +519,12 @@ namespace mo_yanxi::react_flow{
 		}
 
 		[[nodiscard]] request_pass_handle<typename base::return_output_type> request_raw(bool allow_expired) override{
-			if constexpr(descriptor_trait<Ret>::cached){
-				auto state = this->get_data_state();
-				if(state == data_state::fresh || (state == data_state::expired && allow_expired)){
-					return react_flow::make_request_handle_expected_from_data_storage(this->get_cache(), state == data_state::expired);
-				}
-			}
-
-			auto [arguments, state, success] = this->template load_arguments<true>(trigger_type::active, allow_expired, nullptr);
-
-			if(success){
-				return react_flow::make_request_handle_expected_from_data_storage(this->ret_descriptor_ << this->apply(arguments), state == data_state::expired);
-			} else{
-				return make_request_handle_unexpected<typename base::return_output_type>(data_state::failed);
-			}
+			return this->request_from_inputs(allow_expired);
 		}
 
 	protected:
 		void apply_arguments(typename base::argument_pass_type& args){
-			this->store_result(this->apply(args));
+			this->store_result(this->invoke_apply(args));
 		}
 
 		base::return_pass_type apply(base::argument_pass_type& arguments){
@@ -442,6 +549,8 @@ namespace mo_yanxi::react_flow{
 	private:
 		using base = modifier_base<transformer, Ret, Args...>;
 		friend base;
+		template <typename, bool, bool>
+		friend struct static_stage;
 
 		ADAPTED_NO_UNIQUE_ADDRESS Fn fn;
 
@@ -471,28 +580,12 @@ namespace mo_yanxi::react_flow{
 		}
 
 		[[nodiscard]] request_pass_handle<typename base::return_output_type> request_raw(bool allow_expired) override{
-			if constexpr(descriptor_trait<Ret>::cached){
-				auto state = this->get_data_state();
-				if(state == data_state::fresh || (state == data_state::expired && allow_expired)){
-					return react_flow::make_request_handle_expected_from_data_storage(this->get_cache(),
-						state == data_state::expired);
-				}
-			}
-
-			auto [arguments, state, success] = this->template load_arguments<true>(trigger_type::active, allow_expired,
-				nullptr);
-
-			if(success){
-				return react_flow::make_request_handle_expected_from_data_storage(
-					this->ret_descriptor_ << this->apply(arguments), state == data_state::expired);
-			} else{
-				return make_request_handle_unexpected<typename base::return_output_type>(data_state::failed);
-			}
+			return this->request_from_inputs(allow_expired);
 		}
 
 	private:
 		void apply_arguments(typename base::argument_pass_type& args){
-			this->store_result(this->apply(args));
+			this->store_result(this->invoke_apply(args));
 		}
 
 		typename base::return_pass_type apply(base::argument_pass_type& arguments){
@@ -517,6 +610,36 @@ namespace mo_yanxi::react_flow{
 	using extract_value_t = extract_type<T>::type;
 
 
+	/**
+	 * @brief Convert a passed argument (see data_pass_t) to the parameter type declared by the user function
+	 */
+	template <typename Dst, typename Src>
+	FORCE_INLINE Dst adapt_argument_(Src& input){
+		if constexpr(std::is_lvalue_reference_v<Dst> && !std::is_const_v<std::remove_reference_t<Dst>>){
+			static_assert(false, "non const lvalue reference is not allowed");
+		}
+
+		if constexpr(std::convertible_to<Src&, Dst>){
+			return input;
+		} else if constexpr(spec_of<Src, data_carrier>){
+			if constexpr(std::is_reference_v<Dst> && std::is_const_v<std::remove_reference_t<Dst>>){
+				//is const reference, return const view
+				return input.get_ref_view();
+			} else{
+				//crop it to value or rvalue ref
+				return input.get();
+			}
+		} else{
+			static_assert(std::same_as<std::decay_t<Dst>, Src>, "type mismatch ant not convertible");
+
+			if constexpr(std::is_rvalue_reference_v<Dst>){
+				return std::move(input);
+			} else{
+				return Dst{input}; //decay copy
+			}
+		}
+	}
+
 	template <typename Fn>
 	FORCE_INLINE auto adapt_fn_(Fn&& fn){
 		using CurrentTy = function_traits<std::remove_pointer_t<std::decay_t<Fn>>>::mem_func_args_type;
@@ -525,34 +648,9 @@ namespace mo_yanxi::react_flow{
 		if constexpr(std::same_as<CurrentTy, Expected>){
 			return std::forward<Fn>(fn);
 		} else{
-			constexpr static auto adaptor = []<typename Dst, typename Src> FORCE_INLINE (Src& input) static -> Dst{
-				if constexpr(std::is_lvalue_reference_v<Dst> && !std::is_const_v<std::remove_reference_t<Dst>>){
-					static_assert(false, "non const lvalue reference is not allowed");
-				}
-
-				if constexpr(std::convertible_to<Src&, Dst>){
-					return input;
-				} else if constexpr(spec_of<Src, data_carrier>){
-					if constexpr(std::is_reference_v<Dst> && std::is_const_v<std::remove_reference_t<Dst>>){
-						//is const reference, return const view
-						return input.get_ref_view();
-					} else{
-						//crop it to value or rvalue ref
-						return input.get();
-					}
-				} else{
-					static_assert(std::same_as<std::decay_t<Dst>, Src>, "type mismatch ant not convertible");
-
-					if constexpr(std::is_rvalue_reference_v<Dst>){
-						return std::move(input);
-					} else{
-						return Dst{input}; //decay copy
-					}
-				}
-			};
 			return [&]<std::size_t ... Idx>(std::index_sequence<Idx...>){
 				return [f = std::forward<Fn>(fn)] FORCE_INLINE (std::tuple_element_t<Idx, Expected>... args){
-					return std::invoke(f, adaptor.template operator()<std::tuple_element_t<Idx, CurrentTy>>(args)...);
+					return std::invoke(f, react_flow::adapt_argument_<std::tuple_element_t<Idx, CurrentTy>>(args)...);
 				};
 			}(std::make_index_sequence<std::tuple_size_v<CurrentTy>>{});
 		}
@@ -630,4 +728,313 @@ namespace mo_yanxi::react_flow{
 	[[nodiscard]] FORCE_INLINE auto make_transformer(Fn&& fn){
 		return react_flow::make_transformer(propagate_type::eager, std::forward<Fn&&>(fn));
 	}
+
+	/**
+	 * @brief Transformer writing its result into a buffer owned by the node.
+	 *
+	 * The callable receives the previous result as its first argument and overwrites it, so containers keep their
+	 * capacity and steady-state updates allocate nothing. Successors receive a borrowed view of the buffer:
+	 * readers never copy, successors that take ownership (by value parameter or cached descriptor) copy from it.
+	 */
+	export
+	template <typename Ret, typename Fn, typename... Args>
+		requires (std::invocable<
+			const Fn&,
+			typename descriptor_trait<Ret>::input_type&,
+			typename descriptor_trait<Args>::operator_pass_type...>
+			&& spec_of_descriptor<Ret>
+			&& (spec_of_descriptor<Args> && ...))
+	struct inplace_transformer final : modifier_base<inplace_transformer<Ret, Fn, Args...>, Ret, Args...>{
+	private:
+		using base = modifier_base<inplace_transformer, Ret, Args...>;
+		friend base;
+
+	public:
+		using buffer_type = typename descriptor_trait<Ret>::input_type;
+
+	private:
+		ADAPTED_NO_UNIQUE_ADDRESS Fn fn;
+		buffer_type buffer_{};
+
+		//the buffer is being pushed, a successor requesting this node again must not overwrite it
+		bool publishing_{};
+
+	public:
+		[[nodiscard]] inplace_transformer() = default;
+
+		[[nodiscard]] inplace_transformer(propagate_type data_propagate_type, Fn&& fn)
+			: base(data_propagate_type),
+			fn(std::move(fn)){
+		}
+
+		[[nodiscard]] inplace_transformer(propagate_type data_propagate_type, const Fn& fn)
+			: base(data_propagate_type),
+			fn(fn){
+		}
+
+		[[nodiscard]] explicit inplace_transformer(const Fn& fn)
+			: fn(fn){
+		}
+
+		[[nodiscard]] explicit inplace_transformer(Fn&& fn)
+			: fn(std::move(fn)){
+		}
+
+		[[nodiscard]] const buffer_type& get_buffer() const noexcept{
+			return buffer_;
+		}
+
+		[[nodiscard]] request_pass_handle<typename base::return_output_type> request_raw(bool allow_expired) override{
+			if(publishing_){
+				return react_flow::make_request_handle_expected_from_data_storage(
+					this->ret_descriptor_ << typename base::return_pass_type{std::as_const(buffer_)}, false);
+			}
+			return this->request_from_inputs(allow_expired);
+		}
+
+	private:
+		void apply_arguments(typename base::argument_pass_type& args){
+			auto rst = this->invoke_apply(args);
+
+			publishing_ = true;
+			try{
+				this->store_result(std::move(rst));
+			} catch(...){
+				publishing_ = false;
+				throw;
+			}
+			publishing_ = false;
+		}
+
+		typename base::return_pass_type apply(base::argument_pass_type& arguments){
+			[&, this]<std::size_t... Idx>(std::index_sequence<Idx...>){
+				std::invoke(std::as_const(fn), buffer_, react_flow::pass_data(std::get<Idx>(arguments))...);
+			}(std::index_sequence_for<Args...>());
+
+			return typename base::return_pass_type{std::as_const(buffer_)};
+		}
+	};
+
+	template <typename Fn>
+	FORCE_INLINE auto adapt_inplace_fn_(Fn&& fn){
+		using CurrentTy = function_traits<std::remove_pointer_t<std::decay_t<Fn>>>::mem_func_args_type;
+		static_assert(std::tuple_size_v<CurrentTy> > 1, "in-place function requires an output and at least one input");
+
+		using OutputRef = std::tuple_element_t<0, CurrentTy>;
+		static_assert(std::is_lvalue_reference_v<OutputRef> && !std::is_const_v<std::remove_reference_t<OutputRef>>,
+			"the first parameter of in-place function must be a non const lvalue reference to the output");
+		using Output = std::remove_reference_t<OutputRef>;
+
+		return [&]<std::size_t ... Idx>(std::index_sequence<Idx...>){
+			return [f = std::forward<Fn>(fn)] FORCE_INLINE (Output& output,
+				data_pass_t<extract_value_t<std::decay_t<std::tuple_element_t<Idx + 1, CurrentTy>>>>... args){
+				std::invoke(f, output, react_flow::adapt_argument_<std::tuple_element_t<Idx + 1, CurrentTy>>(args)...);
+			};
+		}(std::make_index_sequence<std::tuple_size_v<CurrentTy> - 1>{});
+	}
+
+	template <typename Fn, typename Tup>
+	struct inplace_transformer_unambiguous_helper;
+
+	template <typename Fn, typename Output, typename... Args>
+	struct inplace_transformer_unambiguous_helper<Fn, std::tuple<Output, Args...>>{
+		using type = inplace_transformer<descriptor<std::remove_cvref_t<Output>>, Fn, descriptor<extract_value_t<std::decay_t<Args>>>...>;
+	};
+
+	/**
+	 * @brief Make an inplace_transformer from `void(Output& out, Args... args)`, types are deduced like make_transformer
+	 */
+	export
+	template <typename Fn>
+	[[nodiscard]] FORCE_INLINE auto make_inplace_transformer(propagate_type data_propagate_type, Fn&& fn){
+		using raw_args = typename function_traits<std::remove_pointer_t<std::decay_t<Fn>>>::mem_func_args_type;
+		auto adapted = react_flow::adapt_inplace_fn_(std::forward<Fn>(fn));
+		using type = typename inplace_transformer_unambiguous_helper<decltype(adapted), raw_args>::type;
+		return type{data_propagate_type, std::move(adapted)};
+	}
+
+	export
+	template <typename Fn>
+	[[nodiscard]] FORCE_INLINE auto make_inplace_transformer(Fn&& fn){
+		return react_flow::make_inplace_transformer(propagate_type::eager, std::forward<Fn>(fn));
+	}
+
+	export
+	template <typename... Args, typename Fn>
+		requires (sizeof...(Args) > 0)
+	[[nodiscard]] FORCE_INLINE auto make_inplace_transformer(propagate_type data_propagate_type, Fn&& fn){
+		using raw_args = typename function_traits<std::remove_pointer_t<std::decay_t<Fn>>>::mem_func_args_type;
+		using output_type = std::remove_cvref_t<std::tuple_element_t<0, raw_args>>;
+		auto adapted = react_flow::adapt_inplace_fn_(std::forward<Fn>(fn));
+		return inplace_transformer<descriptor<output_type>, decltype(adapted), make_descriptor_t<Args>...>{
+				data_propagate_type, std::move(adapted)
+			};
+	}
+
+	export
+	template <typename... Args, typename Fn>
+		requires (sizeof...(Args) > 0)
+	[[nodiscard]] FORCE_INLINE auto make_inplace_transformer(Fn&& fn){
+		return react_flow::make_inplace_transformer<Args...>(propagate_type::eager, std::forward<Fn>(fn));
+	}
+
+	template <typename T>
+	struct static_stage_trait : std::false_type{
+	};
+
+	template <typename Ret, typename Fn, typename... Args>
+	struct static_stage_trait<transformer<Ret, Fn, Args...>> : std::true_type{
+		using return_descriptor = Ret;
+		using function_type = Fn;
+		using input_descriptors = std::tuple<Args...>;
+	};
+
+	export
+	template <typename T>
+	concept static_chain_stage = static_stage_trait<T>::value;
+
+	template <typename Prev, typename Next>
+	constexpr bool static_stage_linkable =
+		std::tuple_size_v<typename static_stage_trait<Next>::input_descriptors> == 1
+		&& std::same_as<
+			typename descriptor_trait<typename static_stage_trait<Prev>::return_descriptor>::output_type,
+			typename descriptor_trait<std::tuple_element_t<0, typename static_stage_trait<Next>::input_descriptors>>::input_type>;
+
+	/**
+	 * @brief Every stage after the head is unary and accepts exactly what the previous stage outputs
+	 */
+	template <typename... Stages>
+	consteval bool is_static_chain_linkable(){
+		using stages = std::tuple<Stages...>;
+		return []<std::size_t... Idx>(std::index_sequence<Idx...>){
+			return (static_stage_linkable<std::tuple_element_t<Idx, stages>, std::tuple_element_t<Idx + 1, stages>> && ...);
+		}(std::make_index_sequence<sizeof...(Stages) - 1>{});
+	}
+
+	template <typename Stage, bool head, bool tail>
+	struct static_stage{
+		using trait = static_stage_trait<Stage>;
+		using return_descriptor = typename trait::return_descriptor;
+		using argument_descriptor = std::tuple_element_t<0, typename trait::input_descriptors>;
+
+		ADAPTED_NO_UNIQUE_ADDRESS typename trait::function_type fn;
+
+		//the head reads its arguments from the chain node, the tail stores its result into the chain node
+		ADAPTED_NO_UNIQUE_ADDRESS optional_val<argument_descriptor, !head> argument{};
+		ADAPTED_NO_UNIQUE_ADDRESS optional_val<return_descriptor, !tail> result{};
+
+		[[nodiscard]] explicit static_stage(Stage&& stage)
+			: fn(std::move(stage.fn)){
+		}
+	};
+
+	template <typename Seq, typename... Stages>
+	struct static_stage_storage;
+
+	template <std::size_t... Idx, typename... Stages>
+	struct static_stage_storage<std::index_sequence<Idx...>, Stages...>{
+		using type = std::tuple<static_stage<Stages, Idx == 0, Idx + 1 == sizeof...(Stages)>...>;
+	};
+
+	template <typename Impl, typename Ret, typename ArgsTuple>
+	struct modifier_base_of;
+
+	template <typename Impl, typename Ret, typename... Args>
+	struct modifier_base_of<Impl, Ret, std::tuple<Args...>> : std::type_identity<modifier_base<Impl, Ret, Args...>>{
+	};
+
+	template <typename... Stages>
+	using static_chain_head = std::tuple_element_t<0, std::tuple<Stages...>>;
+
+	template <typename... Stages>
+	using static_chain_tail = std::tuple_element_t<sizeof...(Stages) - 1, std::tuple<Stages...>>;
+
+	/**
+	 * @brief Transformers fused into a single node, checked and inlined at compile time.
+	 *
+	 * The chain takes the inputs of its first stage and outputs the result of its last stage, it is a normal node at
+	 * both ends. Data between stages still goes through the stage descriptors (cache and conversion), but without
+	 * push dispatch, virtual requests or runtime type checks.
+	 */
+	export
+	template <typename... Stages>
+		requires (sizeof...(Stages) > 0 && (static_chain_stage<Stages> && ...) && is_static_chain_linkable<Stages...>())
+	struct static_chain final : modifier_base_of<
+			static_chain<Stages...>,
+			typename static_stage_trait<static_chain_tail<Stages...>>::return_descriptor,
+			typename static_stage_trait<static_chain_head<Stages...>>::input_descriptors>::type{
+	private:
+		using base = typename modifier_base_of<
+			static_chain,
+			typename static_stage_trait<static_chain_tail<Stages...>>::return_descriptor,
+			typename static_stage_trait<static_chain_head<Stages...>>::input_descriptors>::type;
+		friend base;
+
+		static constexpr std::size_t stage_count = sizeof...(Stages);
+
+		using stage_storage = typename static_stage_storage<std::index_sequence_for<Stages...>, Stages...>::type;
+
+		template <std::size_t I>
+		using stage_result_pass_type = typename descriptor_trait<typename std::tuple_element_t<I, stage_storage>::return_descriptor>::input_pass_type;
+
+		ADAPTED_NO_UNIQUE_ADDRESS stage_storage stages_;
+
+	public:
+		[[nodiscard]] explicit static_chain(propagate_type data_propagate_type, Stages&&... stages)
+			: base(data_propagate_type), stages_{std::move(stages)...}{
+		}
+
+		[[nodiscard]] explicit static_chain(Stages&&... stages)
+			: stages_{std::move(stages)...}{
+		}
+
+		[[nodiscard]] request_pass_handle<typename base::return_output_type> request_raw(bool allow_expired) override{
+			return this->request_from_inputs(allow_expired);
+		}
+
+	private:
+		void apply_arguments(typename base::argument_pass_type& args){
+			this->store_result(this->invoke_apply(args));
+		}
+
+		typename base::return_pass_type apply(base::argument_pass_type& arguments){
+			auto& head = std::get<0>(stages_);
+			stage_result_pass_type<0> rst = [&]<std::size_t... Idx>(std::index_sequence<Idx...>) -> stage_result_pass_type<0>{
+				return std::invoke(head.fn, react_flow::pass_data(std::get<Idx>(arguments))...);
+			}(std::make_index_sequence<base::argument_count>{});
+
+			return this->template apply_from<1>(std::move(rst));
+		}
+
+		template <std::size_t I>
+		FORCE_INLINE typename base::return_pass_type apply_from(stage_result_pass_type<I - 1>&& rst){
+			if constexpr(I == stage_count){
+				return std::move(rst);
+			} else{
+				auto& prev = std::get<I - 1>(stages_);
+				auto& cur = std::get<I>(stages_);
+
+				//both carriers may view into the stage caches or each other, keep them alive until the tail returns
+				auto output = *prev.result << std::move(rst);
+				auto argument = *cur.argument << std::move(output);
+				stage_result_pass_type<I> next = std::invoke(cur.fn, react_flow::pass_data(argument));
+
+				return this->template apply_from<I + 1>(std::move(next));
+			}
+		}
+	};
+
+	export
+	template <typename... Stages>
+		requires (sizeof...(Stages) > 0 && (static_chain_stage<Stages> && ...))
+	[[nodiscard]] FORCE_INLINE auto make_static_chain(propagate_type data_propagate_type, Stages... stages){
+		return static_chain<Stages...>{data_propagate_type, std::move(stages)...};
+	}
+
+	export
+	template <typename... Stages>
+		requires (sizeof...(Stages) > 0 && (static_chain_stage<Stages> && ...))
+	[[nodiscard]] FORCE_INLINE auto make_static_chain(Stages... stages){
+		return static_chain<Stages...>{std::move(stages)...};
+	}
 }
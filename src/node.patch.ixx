@@ -0,0 +1,508 @@
+module;
+
+#include <cassert>
+#include <mo_yanxi/adapted_attributes.hpp>
+
+export module mo_yanxi.react_flow:patch;
+
+import :manager;
+import :node_interface;
+import :endpoint;
+import :modifier;
+import mo_yanxi.meta_programming;
+import std;
+
+namespace mo_yanxi::react_flow{
+	export
+	enum struct patch_kind : std::uint8_t{
+		insert,
+		erase,
+		update
+	};
+
+	/**
+	 * @brief One change of a container value.
+	 *
+	 * For sequences key is the index of the first element and count the number of elements, both relative to the
+	 * value after the previous entries of the same patch. For associative containers key is the changed key.
+	 */
+	export
+	template <typename Key>
+	struct patch_entry{
+		patch_kind kind;
+		Key key;
+		std::size_t count{1};
+
+		bool operator==(const patch_entry&) const noexcept = default;
+	};
+
+	export
+	template <typename T>
+	concept patch_sequence = requires(T& value, std::size_t index){
+		typename T::value_type;
+		requires std::ranges::random_access_range<T>;
+		value.insert(value.begin(), index, std::declval<const typename T::value_type&>());
+		value.erase(value.begin(), value.end());
+	};
+
+	export
+	template <typename T>
+	concept patch_associative = requires(T& value, const typename T::key_type& key){
+		typename T::mapped_type;
+		value.find(key);
+		value.erase(key);
+	};
+
+	template <typename T>
+	struct patch_key_of : std::type_identity<std::size_t>{
+	};
+
+	template <patch_associative T>
+	struct patch_key_of<T> : std::type_identity<typename T::key_type>{
+	};
+
+	export
+	template <typename T>
+	using patch_key_t = typename patch_key_of<T>::type;
+
+	/**
+	 * @brief A container value together with the patch that produced it from the previous version.
+	 *
+	 * Patch aware nodes apply the patch to their own state, a full update (or a version gap) makes them rebuild from
+	 * value. Nodes expecting the plain T are fed through connect_unpatched, which forwards value without copying.
+	 */
+	export
+	template <typename T, typename Key = patch_key_t<T>>
+	struct value_patch{
+		using value_type = T;
+		using key_type = Key;
+
+		T value{};
+		std::vector<patch_entry<Key>> patch{};
+		/** @brief Incremented by every update, patch turns the value of version - 1 into this one */
+		std::uint64_t version{};
+		/** @brief No patch is available, the whole value changed */
+		bool full{true};
+
+		[[nodiscard]] std::span<const patch_entry<Key>> get_patch() const noexcept{
+			return patch;
+		}
+	};
+
+	/**
+	 * @brief Source owning a container value, every change pushes the value by reference plus its patch.
+	 */
+	export
+	template <typename T, typename Key = patch_key_t<T>>
+	struct patch_source final : provider_general<value_patch<T, Key>>{
+		using value_type = T;
+		using key_type = Key;
+
+	private:
+		value_patch<T, Key> current_{};
+
+	public:
+		[[nodiscard]] patch_source() = default;
+
+		[[nodiscard]] const T& get_value() const noexcept{
+			return current_.value;
+		}
+
+		[[nodiscard]] std::uint64_t get_version() const noexcept{
+			return current_.version;
+		}
+
+		void assign(T&& value){
+			current_.value = std::move(value);
+			publish_full_();
+		}
+
+		void assign(const T& value){
+			current_.value = value;
+			publish_full_();
+		}
+
+		/**
+		 * @brief Mutate the value in place with fn and publish the patch describing the mutation
+		 */
+		template <std::invocable<T&> Fn>
+		void modify(Fn&& fn, std::span<const patch_entry<Key>> patch){
+			std::invoke(std::forward<Fn>(fn), current_.value);
+			current_.patch.assign(patch.begin(), patch.end());
+			publish_(false);
+		}
+
+		template <std::invocable<T&> Fn>
+		void modify(Fn&& fn, std::initializer_list<patch_entry<Key>> patch){
+			this->modify(std::forward<Fn>(fn), std::span{patch.begin(), patch.size()});
+		}
+
+		template <typename V = T>
+			requires (patch_sequence<V>)
+		void set(std::size_t index, const typename V::value_type& element){
+			assert(index < current_.value.size());
+			current_.value[index] = element;
+			publish_single_(patch_kind::update, index);
+		}
+
+		template <typename V = T>
+			requires (patch_sequence<V>)
+		void insert(std::size_t index, const typename V::value_type& element){
+			assert(index <= current_.value.size());
+			current_.value.insert(current_.value.begin() + index, element);
+			publish_single_(patch_kind::insert, index);
+		}
+
+		template <typename V = T>
+			requires (patch_sequence<V>)
+		void push_back(const typename V::value_type& element){
+			this->insert(current_.value.size(), element);
+		}
+
+		void erase(std::size_t index, std::size_t count = 1) requires (patch_sequence<T>){
+			assert(index + count <= current_.value.size());
+			current_.value.erase(current_.value.begin() + index, current_.value.begin() + (index + count));
+			publish_single_(patch_kind::erase, index, count);
+		}
+
+		template <typename V>
+			requires (patch_associative<T>)
+		void insert_or_assign(const Key& key, V&& mapped){
+			const bool inserted = current_.value.insert_or_assign(key, std::forward<V>(mapped)).second;
+			publish_single_(inserted ? patch_kind::insert : patch_kind::update, key);
+		}
+
+		void erase(const Key& key) requires (patch_associative<T>){
+			if(current_.value.erase(key) == 0) return;
+			publish_single_(patch_kind::erase, key);
+		}
+
+		[[nodiscard]] data_state get_data_state() const noexcept override{
+			return data_state::fresh;
+		}
+
+		request_pass_handle<value_patch<T, Key>> request_raw(bool allow_expired) override{
+			return react_flow::make_request_handle_expected_ref(current_, false);
+		}
+
+	private:
+		void publish_single_(patch_kind kind, const Key& key, std::size_t count = 1){
+			current_.patch.clear();
+			current_.patch.push_back({kind, key, count});
+			publish_(false);
+		}
+
+		void publish_full_(){
+			current_.patch.clear();
+			publish_(true);
+		}
+
+		void publish_(bool full){
+			++current_.version;
+			current_.full = full;
+			this->update_value(data_carrier<value_patch<T, Key>>{std::as_const(current_)});
+		}
+	};
+
+	/**
+	 * @brief Stage consuming value_patch<Kernel::input_type>.
+	 *
+	 * Kernel provides rebuild(const input_type&, output_type&) and
+	 * patch(const input_type&, span<const patch_entry<key_type>>, output_type&). The patch is applied only when it
+	 * continues the last version seen, otherwise the output is rebuilt from the full value; a version already seen
+	 * is not applied again.
+	 */
+	export
+	template <typename Kernel>
+	struct patch_transformer final : modifier_base<patch_transformer<Kernel>,
+			descriptor<typename Kernel::output_type>,
+			descriptor<value_patch<typename Kernel::input_type, typename Kernel::key_type>>>{
+	private:
+		using base = modifier_base<patch_transformer,
+			descriptor<typename Kernel::output_type>,
+			descriptor<value_patch<typename Kernel::input_type, typename Kernel::key_type>>>;
+		friend base;
+
+	public:
+		using input_type = typename Kernel::input_type;
+		using key_type = typename Kernel::key_type;
+		using output_type = typename Kernel::output_type;
+
+	private:
+		Kernel kernel_;
+		output_type buffer_{};
+		std::uint64_t seen_version_{};
+		bool synced_{};
+		std::size_t rebuild_count_{};
+
+	public:
+		[[nodiscard]] explicit patch_transformer(Kernel&& kernel)
+			: kernel_(std::move(kernel)){
+		}
+
+		[[nodiscard]] patch_transformer(propagate_type data_propagate_type, Kernel&& kernel)
+			: base(data_propagate_type), kernel_(std::move(kernel)){
+		}
+
+		[[nodiscard]] const output_type& get_buffer() const noexcept{
+			return buffer_;
+		}
+
+		/**
+		 * @brief Number of updates handled by rebuilding from the full value instead of applying the patch
+		 */
+		[[nodiscard]] std::size_t get_rebuild_count() const noexcept{
+			return rebuild_count_;
+		}
+
+		[[nodiscard]] request_pass_handle<typename base::return_output_type> request_raw(bool allow_expired) override{
+			return this->request_from_inputs(allow_expired);
+		}
+
+	private:
+		void apply_arguments(typename base::argument_pass_type& args){
+			this->store_result(this->invoke_apply(args));
+		}
+
+		typename base::return_pass_type apply(base::argument_pass_type& arguments){
+			const value_patch<input_type, key_type>& input = std::get<0>(arguments).get_ref_view();
+
+			if(synced_ && input.version == seen_version_){
+				return typename base::return_pass_type{std::as_const(buffer_)};
+			}
+
+			if(input.full || !synced_ || input.version != seen_version_ + 1){
+				++rebuild_count_;
+				kernel_.rebuild(input.value, buffer_);
+			} else{
+				kernel_.patch(input.value, input.get_patch(), buffer_);
+			}
+
+			seen_version_ = input.version;
+			synced_ = true;
+			return typename base::return_pass_type{std::as_const(buffer_)};
+		}
+	};
+
+	template <typename In, typename Out, typename Rebuild, typename Patch>
+	struct patch_fn_kernel{
+		using input_type = In;
+		using key_type = patch_key_t<In>;
+		using output_type = Out;
+
+		ADAPTED_NO_UNIQUE_ADDRESS Rebuild rebuild_fn;
+		ADAPTED_NO_UNIQUE_ADDRESS Patch patch_fn;
+
+		void rebuild(const In& value, Out& output){
+			std::invoke(rebuild_fn, output, value);
+		}
+
+		void patch(const In& value, std::span<const patch_entry<key_type>> patch, Out& output){
+			std::invoke(patch_fn, output, value, patch);
+		}
+	};
+
+	//dirty index ranges of a sequence, kept in the coordinates of the latest entry
+	struct dirty_ranges{
+		std::vector<std::pair<std::size_t, std::size_t>> ranges{};
+
+		void on_insert(std::size_t index, std::size_t count){
+			for(auto& [first, last] : ranges){
+				if(index <= first){
+					first += count;
+					last += count;
+				} else if(index < last){
+					last += count;
+				}
+			}
+			ranges.emplace_back(index, index + count);
+		}
+
+		void on_erase(std::size_t index, std::size_t count){
+			const auto map = [=](std::size_t pos) noexcept{
+				return pos < index ? pos : pos < index + count ? index : pos - count;
+			};
+			for(auto& [first, last] : ranges){
+				first = map(first);
+				last = map(last);
+			}
+		}
+
+		void on_update(std::size_t index, std::size_t count){
+			ranges.emplace_back(index, index + count);
+		}
+	};
+
+	template <typename In, typename Out, typename Fn>
+	struct patch_sequence_map_kernel{
+		using input_type = In;
+		using key_type = std::size_t;
+		using output_type = value_patch<std::vector<Out>>;
+
+		ADAPTED_NO_UNIQUE_ADDRESS Fn fn;
+		dirty_ranges dirty_{};
+
+		void rebuild(const In& value, output_type& output){
+			output.value.resize(std::ranges::size(value));
+			for(std::size_t i = 0; i < output.value.size(); ++i){
+				output.value[i] = std::invoke(fn, value[i]);
+			}
+			output.patch.clear();
+			output.full = true;
+			++output.version;
+		}
+
+		void patch(const In& value, std::span<const patch_entry<key_type>> patch, output_type& output){
+			auto& out = output.value;
+			dirty_.ranges.clear();
+
+			for(const auto& entry : patch){
+				switch(entry.kind){
+				case patch_kind::insert : out.insert(out.begin() + entry.key, entry.count, Out{});
+					dirty_.on_insert(entry.key, entry.count);
+					break;
+				case patch_kind::erase : out.erase(out.begin() + entry.key, out.begin() + (entry.key + entry.count));
+					dirty_.on_erase(entry.key, entry.count);
+					break;
+				case patch_kind::update : dirty_.on_update(entry.key, entry.count);
+					break;
+				}
+			}
+
+			assert(out.size() == std::ranges::size(value));
+			for(const auto [first, last] : dirty_.ranges){
+				for(std::size_t i = first; i < last; ++i){
+					out[i] = std::invoke(fn, value[i]);
+				}
+			}
+
+			//elementwise, the structure of the output changes like the input
+			output.patch.assign(patch.begin(), patch.end());
+			output.full = false;
+			++output.version;
+		}
+	};
+
+	template <typename In, typename Out, typename Fn>
+	struct patch_associative_map_kernel{
+		using input_type = In;
+		using key_type = typename In::key_type;
+		using output_type = value_patch<std::conditional_t<requires{ typename In::hasher; },
+			std::unordered_map<key_type, Out>,
+			std::map<key_type, Out>>>;
+
+		ADAPTED_NO_UNIQUE_ADDRESS Fn fn;
+
+		void rebuild(const In& value, output_type& output){
+			output.value.clear();
+			for(const auto& [key, mapped] : value){
+				output.value.emplace(key, std::invoke(fn, mapped));
+			}
+			output.patch.clear();
+			output.full = true;
+			++output.version;
+		}
+
+		void patch(const In& value, std::span<const patch_entry<key_type>> patch, output_type& output){
+			for(const auto& entry : patch){
+				//look the key up in the new value, a later entry of the same patch may have erased it again
+				if(auto itr = value.find(entry.key); itr != value.end()){
+					output.value.insert_or_assign(entry.key, std::invoke(fn, itr->second));
+				} else{
+					output.value.erase(entry.key);
+				}
+			}
+
+			output.patch.assign(patch.begin(), patch.end());
+			output.full = false;
+			++output.version;
+		}
+	};
+
+	/**
+	 * @brief Patch aware stage from a full rebuild `void(Out&, const In&)` and an incremental
+	 * `void(Out&, const In&, span<const patch_entry<Key>>)` update of the same output
+	 */
+	export
+	template <typename Rebuild, typename Patch>
+	[[nodiscard]] FORCE_INLINE auto make_patch_transformer(Rebuild&& rebuild, Patch&& patch){
+		using traits = function_traits<std::remove_pointer_t<std::decay_t<Rebuild>>>;
+		using args = typename traits::mem_func_args_type;
+		using output_type = std::remove_reference_t<std::tuple_element_t<0, args>>;
+		using input_type = std::remove_cvref_t<std::tuple_element_t<1, args>>;
+		static_assert(std::is_lvalue_reference_v<std::tuple_element_t<0, args>> && !std::is_const_v<output_type>,
+			"the first parameter of the rebuild function must be a non const lvalue reference to the output");
+
+		using kernel = patch_fn_kernel<input_type, output_type, std::decay_t<Rebuild>, std::decay_t<Patch>>;
+		return patch_transformer<kernel>{kernel{std::forward<Rebuild>(rebuild), std::forward<Patch>(patch)}};
+	}
+
+	/**
+	 * @brief Patch aware elementwise map of a container, `Out(const value_type&)` for sequences or
+	 * `Out(const mapped_type&)` for associative containers.
+	 *
+	 * Only inserted and updated elements are recomputed, the output is itself a value_patch carrying the same patch
+	 * so a chain of maps stays incremental.
+	 */
+	export
+	template <typename In, typename Fn>
+		requires (patch_sequence<In> || patch_associative<In>)
+	[[nodiscard]] FORCE_INLINE auto make_patch_map(Fn&& fn){
+		if constexpr(patch_associative<In>){
+			using output_type = std::decay_t<std::invoke_result_t<const Fn&, const typename In::mapped_type&>>;
+			using kernel = patch_associative_map_kernel<In, output_type, std::decay_t<Fn>>;
+			return patch_transformer<kernel>{kernel{std::forward<Fn>(fn)}};
+		} else{
+			using output_type = std::decay_t<std::invoke_result_t<const Fn&, const typename In::value_type&>>;
+			using kernel = patch_sequence_map_kernel<In, output_type, std::decay_t<Fn>>;
+			return patch_transformer<kernel>{kernel{std::forward<Fn>(fn)}};
+		}
+	}
+
+	/**
+	 * @brief Forward the full value of a value_patch to nodes unaware of patches.
+	 *
+	 * Pushes borrow the value without copying, a pull copies it.
+	 */
+	export
+	template <typename T, typename Key = patch_key_t<T>>
+	struct patch_unwrapper final : modifier_base<patch_unwrapper<T, Key>, descriptor<T>, descriptor<value_patch<T, Key>>>{
+	private:
+		using base = modifier_base<patch_unwrapper, descriptor<T>, descriptor<value_patch<T, Key>>>;
+		friend base;
+
+	public:
+		[[nodiscard]] patch_unwrapper() = default;
+
+		[[nodiscard]] explicit patch_unwrapper(propagate_type data_propagate_type)
+			: base(data_propagate_type){
+		}
+
+		[[nodiscard]] request_pass_handle<typename base::return_output_type> request_raw(bool allow_expired) override{
+			return this->request_from_inputs(allow_expired);
+		}
+
+	private:
+		void apply_arguments(typename base::argument_pass_type& args){
+			this->profile_count(&node_profile::recomputations);
+			this->store_result(typename base::return_pass_type{std::as_const(std::get<0>(args).get_ref_view().value)});
+		}
+
+		typename base::return_pass_type apply(base::argument_pass_type& arguments){
+			return typename base::return_pass_type{T{std::get<0>(arguments).get_ref_view().value}};
+		}
+	};
+
+	/**
+	 * @brief Add a patch_unwrapper between a patch producer and a consumer of the plain value
+	 * @return the unwrapper, removed with the manager like any other node
+	 */
+	export
+	template <typename T, typename Key>
+	patch_unwrapper<T, Key>& connect_unpatched(manager& manager, type_aware_node<value_patch<T, Key>>& producer, node& consumer){
+		auto& unwrapper = manager.add_node<patch_unwrapper<T, Key>>();
+		producer.connect_successor(unwrapper);
+		unwrapper.connect_successor(consumer);
+		return unwrapper;
+	}
+}
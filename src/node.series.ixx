@@ -0,0 +1,329 @@
+module;
+
+#include <cassert>
+#include <mo_yanxi/adapted_attributes.hpp>
+
+export module mo_yanxi.react_flow:series;
+
+import :manager;
+import :node_interface;
+import :endpoint;
+import :modifier;
+import mo_yanxi.meta_programming;
+import std;
+
+namespace mo_yanxi::react_flow{
+	/**
+	 * @brief The samples appended to an append-only series by one update.
+	 *
+	 * Only the tail travels through the graph, series stages keep whatever state they need about the history,
+	 * so the per-update cost follows the number of new samples instead of the series length.
+	 */
+	export
+	template <typename T>
+	struct series_delta{
+		using value_type = T;
+
+		/** @brief Length of the series before this tail, i.e. the index of tail[0] */
+		std::size_t offset{};
+		std::vector<T> tail{};
+		/** @brief The series restarted at offset, state derived from earlier samples is invalid */
+		bool reset{};
+
+		[[nodiscard]] std::size_t length() const noexcept{
+			return offset + tail.size();
+		}
+
+		bool operator==(const series_delta&) const noexcept = default;
+	};
+
+	/**
+	 * @brief Source of an append-only series, each append pushes only the new samples.
+	 *
+	 * Keeps the last delta (not the history) so that a pull observes the latest tail.
+	 */
+	export
+	template <typename T>
+	struct series_source final : provider_general<series_delta<T>>{
+	private:
+		series_delta<T> last_{};
+
+	public:
+		[[nodiscard]] series_source() = default;
+
+		void append(std::span<const T> values){
+			last_.offset = last_.length();
+			last_.tail.assign(values.begin(), values.end());
+			last_.reset = false;
+			publish_();
+		}
+
+		void append(const T& value){
+			this->append(std::span{&value, 1});
+		}
+
+		/**
+		 * @brief Drop the history and start a new series with values
+		 */
+		void reset(std::span<const T> values = {}){
+			last_.offset = 0;
+			last_.tail.assign(values.begin(), values.end());
+			last_.reset = true;
+			publish_();
+		}
+
+		[[nodiscard]] std::size_t get_length() const noexcept{
+			return last_.length();
+		}
+
+		[[nodiscard]] const series_delta<T>& get_last_delta() const noexcept{
+			return last_;
+		}
+
+		[[nodiscard]] data_state get_data_state() const noexcept override{
+			return data_state::fresh;
+		}
+
+		request_pass_handle<series_delta<T>> request_raw(bool allow_expired) override{
+			return react_flow::make_request_handle_expected_ref(last_, false);
+		}
+
+	private:
+		void publish_(){
+			this->update_value(data_carrier<series_delta<T>>{std::as_const(last_)});
+		}
+	};
+
+	template <typename T>
+	FORCE_INLINE void begin_series_output(series_delta<T>& output, std::size_t offset, bool reset) noexcept{
+		output.offset = offset;
+		output.tail.clear();
+		output.reset = reset;
+	}
+
+	template <typename T>
+	FORCE_INLINE void begin_series_output(T&, std::size_t, bool) noexcept{
+	}
+
+	/**
+	 * @brief Stage consuming series_delta<Kernel::input_type>, the kernel sees every sample exactly once and in order.
+	 *
+	 * Kernel provides restart() and consume(span<const input_type> tail, output_type& output). Deltas already
+	 * consumed (e.g. the same tail pulled again) are skipped, a reset or a gap restarts the kernel at the delta offset.
+	 * A lazy stage only observes the latest delta when pulled, so series stages are meant to be eager.
+	 */
+	export
+	template <typename Kernel>
+	struct series_transformer final : modifier_base<series_transformer<Kernel>,
+			descriptor<typename Kernel::output_type>, descriptor<series_delta<typename Kernel::input_type>>>{
+	private:
+		using base = modifier_base<series_transformer,
+			descriptor<typename Kernel::output_type>, descriptor<series_delta<typename Kernel::input_type>>>;
+		friend base;
+
+	public:
+		using input_type = typename Kernel::input_type;
+		using output_type = typename Kernel::output_type;
+
+	private:
+		Kernel kernel_;
+		output_type buffer_{};
+		std::size_t consumed_{};
+
+	public:
+		[[nodiscard]] explicit series_transformer(Kernel&& kernel)
+			: kernel_(std::move(kernel)){
+		}
+
+		[[nodiscard]] series_transformer(propagate_type data_propagate_type, Kernel&& kernel)
+			: base(data_propagate_type), kernel_(std::move(kernel)){
+		}
+
+		/**
+		 * @brief The last output, a delta for series outputs or the running value for reductions
+		 */
+		[[nodiscard]] const output_type& get_buffer() const noexcept{
+			return buffer_;
+		}
+
+		/**
+		 * @brief Length of the input series folded into the current state
+		 */
+		[[nodiscard]] std::size_t get_consumed_length() const noexcept{
+			return consumed_;
+		}
+
+		[[nodiscard]] request_pass_handle<typename base::return_output_type> request_raw(bool allow_expired) override{
+			return this->request_from_inputs(allow_expired);
+		}
+
+	private:
+		void apply_arguments(typename base::argument_pass_type& args){
+			this->store_result(this->invoke_apply(args));
+		}
+
+		typename base::return_pass_type apply(base::argument_pass_type& arguments){
+			const series_delta<input_type>& delta = std::get<0>(arguments).get_ref_view();
+			const std::size_t end = delta.length();
+
+			const bool restart = delta.reset || delta.offset > consumed_;
+			if(restart){
+				kernel_.restart();
+				consumed_ = delta.offset;
+			} else if(end <= consumed_){
+				return typename base::return_pass_type{std::as_const(buffer_)};
+			}
+
+			react_flow::begin_series_output(buffer_, consumed_, restart);
+			kernel_.consume(std::span{delta.tail}.subspan(consumed_ - delta.offset), buffer_);
+			consumed_ = end;
+
+			return typename base::return_pass_type{std::as_const(buffer_)};
+		}
+	};
+
+	template <typename In, typename Out, typename Fn>
+	struct series_map_kernel{
+		using input_type = In;
+		using output_type = series_delta<Out>;
+
+		ADAPTED_NO_UNIQUE_ADDRESS Fn fn;
+
+		void restart() noexcept{
+		}
+
+		FORCE_INLINE void consume(std::span<const In> tail, output_type& output) const{
+			output.tail.resize(tail.size());
+			Out* const dst = output.tail.data();
+			for(std::size_t i = 0; i < tail.size(); ++i){
+				dst[i] = std::invoke(fn, tail[i]);
+			}
+		}
+	};
+
+	//running fold shared by scan and reduce, without an initial value the first sample seeds the state
+	template <typename In, typename State, typename Fn>
+	struct series_fold_state{
+		using input_type = In;
+
+		ADAPTED_NO_UNIQUE_ADDRESS Fn fn;
+		State initial;
+		bool seeded_by_first;
+		State state{initial};
+		bool primed{!seeded_by_first};
+
+		void restart(){
+			state = initial;
+			primed = !seeded_by_first;
+		}
+
+		FORCE_INLINE std::span<const In> prime(std::span<const In> tail){
+			if(primed || tail.empty()) return tail;
+			state = static_cast<State>(tail.front());
+			primed = true;
+			return tail.subspan(1);
+		}
+
+		FORCE_INLINE void step(const In& value){
+			state = std::invoke(fn, std::as_const(state), value);
+		}
+	};
+
+	template <typename In, typename State, typename Fn>
+	struct series_scan_kernel : series_fold_state<In, State, Fn>{
+		using output_type = series_delta<State>;
+
+		FORCE_INLINE void consume(std::span<const In> tail, output_type& output){
+			output.tail.resize(tail.size());
+			State* dst = output.tail.data();
+			if(!this->primed && !tail.empty()){
+				tail = this->prime(tail);
+				*dst++ = this->state;
+			}
+			for(const In& value : tail){
+				this->step(value);
+				*dst++ = this->state;
+			}
+		}
+	};
+
+	template <typename In, typename State, typename Fn>
+	struct series_reduce_kernel : series_fold_state<In, State, Fn>{
+		using output_type = State;
+
+		FORCE_INLINE void consume(std::span<const In> tail, output_type& output){
+			for(const In& value : this->prime(tail)){
+				this->step(value);
+			}
+			output = this->state;
+		}
+	};
+
+	/**
+	 * @brief Stage applying `Out(In)` to each appended sample, series_delta<In> into series_delta<Out>
+	 */
+	export
+	template <typename Fn>
+	[[nodiscard]] FORCE_INLINE auto make_series_map(Fn&& fn){
+		using traits = function_traits<std::remove_pointer_t<std::decay_t<Fn>>>;
+		using input_type = std::decay_t<std::tuple_element_t<0, typename traits::mem_func_args_type>>;
+		using output_type = std::decay_t<typename traits::return_type>;
+
+		using kernel = series_map_kernel<input_type, output_type, std::decay_t<Fn>>;
+		return series_transformer<kernel>{kernel{std::forward<Fn>(fn)}};
+	}
+
+	/**
+	 * @brief Stage emitting the running `State(State, In)` fold for each appended sample, started from initial
+	 */
+	export
+	template <typename Fn, typename Init>
+	[[nodiscard]] FORCE_INLINE auto make_series_scan(Init&& initial, Fn&& fn){
+		using traits = function_traits<std::remove_pointer_t<std::decay_t<Fn>>>;
+		using input_type = std::decay_t<std::tuple_element_t<1, typename traits::mem_func_args_type>>;
+		using state_type = std::decay_t<typename traits::return_type>;
+
+		using kernel = series_scan_kernel<input_type, state_type, std::decay_t<Fn>>;
+		return series_transformer<kernel>{kernel{{std::forward<Fn>(fn), state_type(std::forward<Init>(initial)), false}}};
+	}
+
+	/**
+	 * @brief Stage emitting the running fold for each appended sample, seeded by the first sample of the series
+	 */
+	export
+	template <typename Fn>
+	[[nodiscard]] FORCE_INLINE auto make_series_scan(Fn&& fn){
+		using traits = function_traits<std::remove_pointer_t<std::decay_t<Fn>>>;
+		using input_type = std::decay_t<std::tuple_element_t<1, typename traits::mem_func_args_type>>;
+		using state_type = std::decay_t<typename traits::return_type>;
+
+		using kernel = series_scan_kernel<input_type, state_type, std::decay_t<Fn>>;
+		return series_transformer<kernel>{kernel{{std::forward<Fn>(fn), state_type{}, true}}};
+	}
+
+	/**
+	 * @brief Exponential moving average `alpha * x + (1 - alpha) * prev`, seeded by the first sample
+	 */
+	export
+	template <std::floating_point T = double>
+	[[nodiscard]] FORCE_INLINE auto make_series_ema(T alpha){
+		assert(alpha >= T{0} && alpha <= T{1});
+		return react_flow::make_series_scan([alpha](T prev, T value) -> T{
+			return alpha * value + (T{1} - alpha) * prev;
+		});
+	}
+
+	/**
+	 * @brief Stage outputting the running `State(State, In)` fold of the whole series, e.g. a running sum
+	 */
+	export
+	template <typename Fn, typename Init>
+	[[nodiscard]] FORCE_INLINE auto make_series_reduce(Init&& initial, Fn&& fn){
+		using traits = function_traits<std::remove_pointer_t<std::decay_t<Fn>>>;
+		using input_type = std::decay_t<std::tuple_element_t<1, typename traits::mem_func_args_type>>;
+		using state_type = std::decay_t<typename traits::return_type>;
+
+		using kernel = series_reduce_kernel<input_type, state_type, std::decay_t<Fn>>;
+		return series_transformer<kernel>{kernel{{std::forward<Fn>(fn), state_type(std::forward<Init>(initial)), false}}};
+	}
+}
@@ -35,19 +35,19 @@ namespace mo_yanxi::react_flow{
 
 
 		void update_value(T&& value){
-			react_flow::push_to_successors(successors, data_carrier{std::move(value)});
+			react_flow::push_to_successors(*this, successors, data_carrier{std::move(value)});
 		}
 
 		void update_value(const T& value){
-			react_flow::push_to_successors(successors, data_carrier{value});
+			react_flow::push_to_successors(*this, successors, data_carrier{value});
 		}
 
 		void update_value(data_carrier<T>& data){
-			react_flow::push_to_successors(successors, std::move(data));
+			react_flow::push_to_successors(*this, successors, std::move(data));
 		}
 
 		void update_value(data_carrier<T>&& data){
-			react_flow::push_to_successors(successors, std::move(data));
+			react_flow::push_to_successors(*this, successors, std::move(data));
 		}
 
 		[[nodiscard]] std::span<const data_type_index> get_in_socket_type_index() const noexcept final{
@@ -70,6 +70,10 @@ namespace mo_yanxi::react_flow{
 			return make_request_handle_unexpected<T>(data_state::failed);
 		}
 
+		[[nodiscard]] bool serves_stable_value() const noexcept override{
+			return true;
+		}
+
 		bool erase_successors_single_edge(std::size_t slot, node& post) noexcept final{
 			return try_erase(successors, slot, post);
 		}
@@ -283,7 +287,8 @@ namespace mo_yanxi::react_flow{
 
 		void on_push(const std::size_t from_index, data_carrier_obj&& in_data){
 			switch(this->data_propagate_type_){
-			case propagate_type::eager : this->data_pending_state_ = data_pending_state::done;
+			case propagate_type::eager :
+			case propagate_type::topological : this->data_pending_state_ = data_pending_state::done;
 				{
 					auto& storage = data_carrier_cast<T>(in_data);
 					this->on_update(storage);
@@ -303,6 +308,7 @@ namespace mo_yanxi::react_flow{
 					auto& storage = data_carrier_cast<T>(in_data);
 					cache_ = storage.get();
 				}
+				this->request_pulse();
 				break;
 			default : std::unreachable();
 			}
@@ -349,6 +355,10 @@ struct provider_cached : provider_general<O> {
 private:
     T data_{};
     ADAPTED_NO_UNIQUE_ADDRESS F converter_{};
+    manager* manager_{};
+
+    bool distinct_{};
+    ADAPTED_NO_UNIQUE_ADDRESS optional_val<distinct_record<T, true>, distinct_comparable<T, true>> distinct_record_{};
 
 public:
     [[nodiscard]] provider_cached() = default;
@@ -360,23 +370,41 @@ public:
 
 	void update_value_quiet(T&& value) {
     	data_ = std::move(value);
+    	reset_distinct_record_();
     }
 
 	void update_value_quiet(const T& value) {
     	data_ = value;
+    	reset_distinct_record_();
     }
 
 
     void update_value(T&& value) {
+        if(!check_changed_(value)) return;
         data_ = std::move(value);
         on_update();
     }
 
     void update_value(const T& value) {
+        if(!check_changed_(value)) return;
         data_ = value;
         on_update();
     }
 
+    [[nodiscard]] bool is_distinct() const noexcept {
+        return distinct_;
+    }
+
+    /**
+     * @brief Skip update_value (no push and no mark_updated) when the new value equals the last one
+     *
+     * Compared by value, or by distinct_hash if it is specialized for T.
+     */
+    void set_distinct(bool distinct) noexcept requires (distinct_comparable<T, true>) {
+        distinct_ = distinct;
+        reset_distinct_record_();
+    }
+
     const T& get_raw_cache() const noexcept {
         return data_;
     }
@@ -387,7 +415,7 @@ public:
 
     bool pull_and_push([[maybe_unused]] bool allow_expired) override {
         this->data_pending_state_ = data_pending_state::done;
-        react_flow::push_to_successors(this->successors, make_output_carrier_());
+        react_flow::push_to_successors(*this, this->successors, make_output_carrier_());
         return true;
     }
 
@@ -403,6 +431,7 @@ public:
         }
 
         val = std::forward<Ty>(value);
+        reset_distinct_record_();
         on_update();
     }
 
@@ -416,12 +445,37 @@ public:
         return react_flow::make_request_handle_expected<O>(get_output_cache(), false);
     }
 
+    void set_manager(manager& manager) override {
+        manager_ = std::addressof(manager);
+    }
+
+    void reset_manager() noexcept override {
+        manager_ = nullptr;
+    }
+
 protected:
+    [[nodiscard]] manager* get_manager() const noexcept {
+        return manager_;
+    }
 
     void on_pulse_received(manager& m) override {
         if(this->data_pending_state_ != data_pending_state::waiting_pulse) return;
         this->data_pending_state_ = data_pending_state::done;
-        react_flow::push_to_successors(this->successors, make_output_carrier_());
+        react_flow::push_to_successors(*this, this->successors, make_output_carrier_());
+    }
+
+private:
+    bool check_changed_(const T& value) {
+        if constexpr (distinct_comparable<T, true>) {
+            if(distinct_) return (*distinct_record_).check_changed(value, std::addressof(data_));
+        }
+        return true;
+    }
+
+    void reset_distinct_record_() noexcept {
+        if constexpr (distinct_comparable<T, true>) {
+            (*distinct_record_).reset();
+        }
     }
 
 private:
@@ -436,8 +490,10 @@ private:
     void on_update() {
         switch(this->data_propagate_type_) {
         case propagate_type::eager :
+        case propagate_type::topological :
+            if(this->defer_to_transaction(manager_)) break;
             this->data_pending_state_ = data_pending_state::done;
-            react_flow::push_to_successors(this->successors, make_output_carrier_());
+            react_flow::push_to_successors(*this, this->successors, make_output_carrier_());
             break;
         case propagate_type::lazy :
             this->data_pending_state_ = data_pending_state::done;
@@ -445,6 +501,7 @@ private:
             break;
         case propagate_type::pulse :
             this->data_pending_state_ = data_pending_state::waiting_pulse;
+            this->request_pulse();
             break;
         default : std::unreachable();
         }
@@ -452,6 +509,211 @@ private:
 };
 
 
+/**
+ * @brief Single producer single consumer triple buffer, the consumer always observes the latest complete write.
+ *
+ * Exchanges are sequentially consistent, pairing with the dirty flag of concurrent_source so a write racing with a drain
+ * is either observed by that drain or queues the source again.
+ */
+template <typename T>
+struct latest_value_slot{
+private:
+    static constexpr std::uint8_t index_mask = 0b011;
+    static constexpr std::uint8_t fresh_bit = 0b100;
+
+    std::array<T, 3> buffers_{};
+    std::uint8_t back_{0};
+    std::atomic<std::uint8_t> middle_{1};
+    std::uint8_t front_{2};
+
+public:
+    template <typename U>
+    void store(U&& value){
+        buffers_[back_] = std::forward<U>(value);
+        back_ = middle_.exchange(back_ | fresh_bit) & index_mask;
+    }
+
+    /**
+     * @return the latest value, or nullptr if nothing is stored since the last load
+     */
+    [[nodiscard]] T* load() noexcept{
+        if(!(middle_.load() & fresh_bit)) return nullptr;
+        front_ = middle_.exchange(front_) & index_mask;
+        return std::addressof(buffers_[front_]);
+    }
+};
+
+/**
+ * @brief Bounded single producer single consumer ring, capacity is rounded up to a power of two
+ */
+template <typename T>
+struct spsc_ring{
+private:
+    std::unique_ptr<T[]> buffer_;
+    std::size_t mask_;
+    std::atomic<std::size_t> head_{};
+    std::atomic<std::size_t> tail_{};
+
+public:
+    [[nodiscard]] explicit spsc_ring(std::size_t capacity)
+        : buffer_(std::make_unique<T[]>(std::bit_ceil(std::max<std::size_t>(capacity, 1)))),
+        mask_(std::bit_ceil(std::max<std::size_t>(capacity, 1)) - 1){
+    }
+
+    [[nodiscard]] std::size_t capacity() const noexcept{
+        return mask_ + 1;
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept{
+        return tail_.load(std::memory_order_relaxed) - head_.load(std::memory_order_relaxed);
+    }
+
+    template <typename U>
+    [[nodiscard]] bool try_push(U&& value){
+        const auto tail = tail_.load(std::memory_order_relaxed);
+        if(tail - head_.load(std::memory_order_acquire) > mask_) return false;
+
+        buffer_[tail & mask_] = std::forward<U>(value);
+        tail_.store(tail + 1);
+        return true;
+    }
+
+    /**
+     * @brief Pop every value pushed before the call in order, the slot is released before fn is invoked
+     */
+    template <std::invocable<T&&> Fn>
+    void consume(Fn fn){
+        auto head = head_.load(std::memory_order_relaxed);
+        const auto tail = tail_.load();
+
+        for(; head != tail; ++head){
+            T value = std::move(buffer_[head & mask_]);
+            head_.store(head + 1, std::memory_order_release);
+            std::invoke(fn, std::move(value));
+        }
+    }
+};
+
+/**
+ * @brief Cached provider written from another thread, the latest value is pushed on the next manager::update.
+ *
+ * post_value costs one atomic exchange (and a CAS on the first write since the last update) instead of a posted act,
+ * values overwritten before the update are never pushed. All providers drained by one update are committed in a single
+ * transaction. Writes are dropped while the provider is not in a manager, it is written by one producer thread at a time.
+ */
+export
+template <typename T>
+    requires (std::default_initializable<T> && std::movable<T>)
+struct provider_concurrent : provider_cached<T>, concurrent_source {
+private:
+    latest_value_slot<T> slot_{};
+
+public:
+    [[nodiscard]] provider_concurrent() = default;
+
+    [[nodiscard]] explicit provider_concurrent(propagate_type propagate_type)
+        : provider_cached<T>(propagate_type) {
+    }
+
+    ~provider_concurrent() {
+        if(manager* manager = this->get_owner()) manager->erase_dirty_source(*this);
+    }
+
+    /**
+     * @brief Thread safe for the single producer thread, the value is dropped once the provider left its manager.
+     */
+    template <typename U = T>
+        requires (std::assignable_from<T&, U&&>)
+    void post_value(U&& value) {
+        manager* manager = this->get_owner();
+        if(!manager) return;
+        slot_.store(std::forward<U>(value));
+        manager->mark_source_dirty(*this);
+    }
+
+    void set_manager(manager& manager) override {
+        provider_cached<T>::set_manager(manager);
+        this->set_owner(std::addressof(manager));
+    }
+
+    void reset_manager() noexcept override {
+        if(manager* manager = this->get_owner()) manager->erase_dirty_source(*this);
+        this->set_owner(nullptr);
+        provider_cached<T>::reset_manager();
+    }
+
+protected:
+    void drain() override {
+        if(T* value = slot_.load()){
+            this->update_value(std::move(*value));
+        }
+    }
+};
+
+/**
+ * @brief Provider written from another thread, every value is pushed in order on the next manager::update.
+ *
+ * Values are kept in a bounded ring and try_post_value fails when it is full, so the producer decides whether to drop or
+ * retry. Writes fail while the provider is not in a manager, it is written by one producer thread at a time.
+ */
+export
+template <typename T>
+    requires (std::default_initializable<T> && std::movable<T>)
+struct provider_concurrent_queue : provider_general<T>, concurrent_source {
+private:
+    spsc_ring<T> ring_;
+
+public:
+    [[nodiscard]] explicit provider_concurrent_queue(std::size_t capacity = 64)
+        : ring_(capacity) {
+    }
+
+    ~provider_concurrent_queue() {
+        if(manager* manager = this->get_owner()) manager->erase_dirty_source(*this);
+    }
+
+    /**
+     * @brief Thread safe for the single producer thread.
+     * @return false if the ring is full or the provider left its manager, the value is not consumed then
+     */
+    template <typename U = T>
+        requires (std::assignable_from<T&, U&&>)
+    [[nodiscard]] bool try_post_value(U&& value) {
+        manager* manager = this->get_owner();
+        if(!manager) return false;
+        if(!ring_.try_push(std::forward<U>(value))) return false;
+        manager->mark_source_dirty(*this);
+        return true;
+    }
+
+    [[nodiscard]] std::size_t get_capacity() const noexcept {
+        return ring_.capacity();
+    }
+
+    /**
+     * @brief Approximate count of values not drained yet.
+     */
+    [[nodiscard]] std::size_t get_pending_count() const noexcept {
+        return ring_.size();
+    }
+
+    void set_manager(manager& manager) override {
+        this->set_owner(std::addressof(manager));
+    }
+
+    void reset_manager() noexcept override {
+        if(manager* manager = this->get_owner()) manager->erase_dirty_source(*this);
+        this->set_owner(nullptr);
+    }
+
+protected:
+    void drain() override {
+        ring_.consume([this](T&& value) {
+            this->update_value(std::move(value));
+        });
+    }
+};
+
 template <auto mfptr>
 struct member_ptr_invoker{
 	using MptrTrait = mptr_info<decltype(mfptr)>;
@@ -0,0 +1,269 @@
+module;
+
+#include <cassert>
+#include <version>
+
+export module mo_yanxi.react_flow:posted_act_queue;
+
+import std;
+
+namespace mo_yanxi::react_flow{
+
+/**
+ * @brief Multi producer single consumer queue of void() callables, stored inline in a fixed ring of slots.
+ *
+ * Enqueue is lock-free (bounded MPMC ring with per-slot sequence numbers) and does not allocate for callables fitting
+ * in a slot. Larger callables are boxed on the heap but still keep their place in the ring.
+ * When the ring is full, acts fall back to a locked overflow list until the consumer drains it, every act posted by one
+ * thread is still executed in posting order.
+ */
+struct posted_act_queue{
+	static constexpr std::size_t inline_size = 48;
+
+private:
+#ifdef __cpp_lib_move_only_function
+	using overflow_act = std::move_only_function<void()>;
+#else
+	using overflow_act = std::function<void()>;
+#endif
+
+	struct act_vtable{
+		void (*run)(void* storage);
+		void (*destroy)(void* storage) noexcept;
+		void (*transfer)(void* storage, posted_act_queue& target);
+	};
+
+	template <typename Fn>
+	static constexpr bool fits_inline = sizeof(Fn) <= inline_size && alignof(Fn) <= alignof(std::max_align_t);
+
+	template <typename Fn>
+	static constexpr act_vtable inline_vtable{
+		+[](void* storage){
+			std::invoke(*static_cast<Fn*>(storage));
+		},
+		+[](void* storage) noexcept{
+			std::destroy_at(static_cast<Fn*>(storage));
+		},
+		+[](void* storage, posted_act_queue& target){
+			target.push(std::move(*static_cast<Fn*>(storage)));
+		}
+	};
+
+	template <typename Fn>
+	static constexpr act_vtable boxed_vtable{
+		+[](void* storage){
+			std::invoke(**static_cast<Fn**>(storage));
+		},
+		+[](void* storage) noexcept{
+			delete *static_cast<Fn**>(storage);
+		},
+		+[](void* storage, posted_act_queue& target){
+			target.push(std::move(**static_cast<Fn**>(storage)));
+		}
+	};
+
+	struct slot{
+		std::atomic<std::size_t> sequence{};
+		const act_vtable* vtable{};
+		alignas(std::max_align_t) std::byte storage[inline_size];
+	};
+
+	std::unique_ptr<slot[]> slots_;
+	std::size_t mask_;
+
+	std::atomic<std::size_t> enqueue_pos_{};
+	std::size_t dequeue_pos_{};
+
+	//set when the ring is full, acts go to the overflow list until the consumer drains it, which keeps per thread order
+	std::atomic<bool> overflowing_{};
+	std::mutex overflow_mutex_{};
+	std::vector<overflow_act> overflow_{};
+	std::vector<overflow_act> overflow_drained_{};
+
+	template <typename Fn>
+	bool try_push_ring(Fn&& fn){
+		using act_type = std::remove_cvref_t<Fn>;
+
+		auto pos = enqueue_pos_.load(std::memory_order_relaxed);
+		slot* target;
+		while(true){
+			target = &slots_[pos & mask_];
+			const auto sequence = target->sequence.load(std::memory_order_acquire);
+			const auto diff = static_cast<std::ptrdiff_t>(sequence - pos);
+			if(diff == 0){
+				if(enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+			} else if(diff < 0){
+				return false;
+			} else{
+				pos = enqueue_pos_.load(std::memory_order_relaxed);
+			}
+		}
+
+		//the position is claimed, the slot must be published even if constructing the act throws
+		try{
+			if constexpr(fits_inline<act_type>){
+				std::construct_at(reinterpret_cast<act_type*>(target->storage), std::forward<Fn>(fn));
+				target->vtable = &inline_vtable<act_type>;
+			} else{
+				*reinterpret_cast<act_type**>(target->storage) = new act_type(std::forward<Fn>(fn));
+				target->vtable = &boxed_vtable<act_type>;
+			}
+		} catch(...){
+			target->vtable = nullptr;
+			target->sequence.store(pos + 1, std::memory_order_release);
+			throw;
+		}
+
+		target->sequence.store(pos + 1, std::memory_order_release);
+		return true;
+	}
+
+	struct slot_release_guard{
+		slot& target;
+		std::size_t next_sequence;
+
+		~slot_release_guard(){
+			if(target.vtable) target.vtable->destroy(target.storage);
+			target.vtable = nullptr;
+			target.sequence.store(next_sequence, std::memory_order_release);
+		}
+	};
+
+	/**
+	 * @brief Pop acts up to (excluding) the position end, waiting for producers that claimed a slot but not finished yet
+	 */
+	template <typename Op>
+	void consume_ring(std::size_t end, Op op){
+		while(dequeue_pos_ != end){
+			const auto pos = dequeue_pos_;
+			slot& target = slots_[pos & mask_];
+			while(target.sequence.load(std::memory_order_acquire) != pos + 1){
+				std::this_thread::yield();
+			}
+
+			//advance first, the slot is released even if the act throws
+			++dequeue_pos_;
+			const slot_release_guard _{target, pos + mask_ + 1};
+			if(target.vtable) op(*target.vtable, static_cast<void*>(target.storage));
+		}
+	}
+
+public:
+	[[nodiscard]] explicit posted_act_queue(std::size_t capacity = 1024)
+		: slots_(std::make_unique<slot[]>(std::bit_ceil(std::max<std::size_t>(capacity, 2)))),
+		mask_(std::bit_ceil(std::max<std::size_t>(capacity, 2)) - 1){
+		for(std::size_t i = 0; i <= mask_; ++i){
+			slots_[i].sequence.store(i, std::memory_order_relaxed);
+		}
+	}
+
+	posted_act_queue(const posted_act_queue& other) = delete;
+	posted_act_queue(posted_act_queue&& other) noexcept = delete;
+	posted_act_queue& operator=(const posted_act_queue& other) = delete;
+	posted_act_queue& operator=(posted_act_queue&& other) noexcept = delete;
+
+	~posted_act_queue(){
+		clear();
+	}
+
+	[[nodiscard]] std::size_t capacity() const noexcept{
+		return mask_ + 1;
+	}
+
+	/**
+	 * @brief Thread safe
+	 */
+	template <std::invocable<> Fn>
+		requires (std::move_constructible<std::remove_cvref_t<Fn>>)
+	void push(Fn&& fn){
+		if(!overflowing_.load(std::memory_order_acquire) && try_push_ring(std::forward<Fn>(fn))) return;
+
+		std::lock_guard _{overflow_mutex_};
+		//the consumer may have drained the overflow meanwhile
+		if(!overflowing_.load(std::memory_order_relaxed) && try_push_ring(std::forward<Fn>(fn))) return;
+		overflow_.emplace_back(std::forward<Fn>(fn));
+		overflowing_.store(true, std::memory_order_release);
+	}
+
+	/**
+	 * @brief Called on the consumer thread, run every act posted before the call.
+	 *
+	 * Acts posted by the running acts are executed on the next drain.
+	 * If an act throws, the exception propagates and the acts not executed yet are kept for the next drain.
+	 */
+	void drain(){
+		if(!overflow_drained_.empty()){
+			//left by an act that threw during the last drain
+			run_overflow_drained();
+		}
+
+		if(!overflowing_.load(std::memory_order_acquire)){
+			consume_ring(enqueue_pos_.load(std::memory_order_acquire), [](const act_vtable& vtable, void* storage){
+				vtable.run(storage);
+			});
+			return;
+		}
+
+		std::size_t end;
+		{
+			std::lock_guard _{overflow_mutex_};
+			//acts entered the ring before the overflow are ordered before it
+			end = enqueue_pos_.load(std::memory_order_acquire);
+			overflow_drained_.swap(overflow_);
+			overflowing_.store(false, std::memory_order_release);
+		}
+
+		consume_ring(end, [](const act_vtable& vtable, void* storage){
+			vtable.run(storage);
+		});
+		run_overflow_drained();
+	}
+
+	/**
+	 * @brief Called on the consumer thread, move every pending act to target in order without running them
+	 */
+	void transfer_to(posted_act_queue& target){
+		for(auto& act : overflow_drained_){
+			target.push(std::move(act));
+		}
+		overflow_drained_.clear();
+
+		std::lock_guard _{overflow_mutex_};
+		consume_ring(enqueue_pos_.load(std::memory_order_acquire), [&target](const act_vtable& vtable, void* storage){
+			vtable.transfer(storage, target);
+		});
+		for(auto& act : overflow_){
+			target.push(std::move(act));
+		}
+		overflow_.clear();
+		overflowing_.store(false, std::memory_order_release);
+	}
+
+	/**
+	 * @brief Called on the consumer thread, destroy every pending act without running them
+	 */
+	void clear() noexcept{
+		overflow_drained_.clear();
+		consume_ring(enqueue_pos_.load(std::memory_order_acquire), [](const act_vtable&, void*){});
+
+		std::lock_guard _{overflow_mutex_};
+		overflow_.clear();
+		overflowing_.store(false, std::memory_order_relaxed);
+	}
+
+private:
+	void run_overflow_drained(){
+		auto itr = overflow_drained_.begin();
+		try{
+			for(; itr != overflow_drained_.end(); ++itr){
+				std::invoke(*itr);
+			}
+		} catch(...){
+			overflow_drained_.erase(overflow_drained_.begin(), std::next(itr));
+			throw;
+		}
+		overflow_drained_.clear();
+	}
+};
+
+}
@@ -4,9 +4,15 @@ module;
 
 export module mo_yanxi.react_flow;
 
+export import :fork_join_pool;
+export import :posted_act_queue;
 export import :node_interface;
 export import :endpoint;
 export import :async;
+export import :coroutine;
+export import :batch;
+export import :series;
+export import :patch;
 export import :successory_list;
 export import :modifier;
 
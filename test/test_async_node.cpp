@@ -261,3 +261,355 @@ TEST(AsyncNodeTest, AsyncProgressTest) {
     EXPECT_TRUE(progress_received);
     EXPECT_GE(last_progress, 1.0f);
 }
+
+TEST(AsyncNodeTest, MultiWorkerRunsTasksConcurrently) {
+    manager mgr{manager_config{.async_worker_count = 2}};
+    ASSERT_EQ(mgr.get_async_worker_count(), 2);
+
+    auto& source = mgr.add_node<provider_cached<int>>();
+
+    std::atomic<int> running = 0;
+    std::atomic<int> max_running = 0;
+    std::atomic<int> completed_count = 0;
+
+    auto task = [&](int v) -> int {
+        const int cur = ++running;
+        int prev = max_running.load();
+        while (prev < cur && !max_running.compare_exchange_weak(prev, cur)) {}
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        --running;
+        ++completed_count;
+        return v;
+    };
+
+    auto& processor_a = mgr.add_node(make_async_transformer(propagate_type::eager, async_type::async_all, task));
+    auto& processor_b = mgr.add_node(make_async_transformer(propagate_type::eager, async_type::async_all, task));
+
+    std::atomic<int> received = 0;
+    auto& listener_a = mgr.add_node(make_listener([&](int){ ++received; }));
+    auto& listener_b = mgr.add_node(make_listener([&](int){ ++received; }));
+
+    source.connect_successor(processor_a);
+    source.connect_successor(processor_b);
+    processor_a.connect_successor(listener_a);
+    processor_b.connect_successor(listener_b);
+
+    source.update_value(1);
+
+    auto start = std::chrono::steady_clock::now();
+    while (received < 2) {
+        mgr.update();
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        if (std::chrono::steady_clock::now() - start > std::chrono::seconds(5)) break;
+    }
+
+    EXPECT_EQ(completed_count, 2);
+    EXPECT_EQ(received, 2);
+    EXPECT_EQ(max_running, 2);
+}
+
+TEST(AsyncNodeTest, RecycledTaskResultsAreFresh) {
+    manager mgr;
+    auto& source = mgr.add_node<provider_cached<int>>();
+
+    auto& processor = mgr.add_node(make_async_transformer(
+        propagate_type::eager,
+        async_type::async_all,
+        [](int v) -> int {
+            return v * 10;
+        }
+    ));
+    processor.set_task_recycle_limit(1);
+
+    std::vector<int> received;
+    auto& listener = mgr.add_node(make_listener([&](int v){
+        received.push_back(v);
+    }));
+
+    source.connect_successor(processor);
+    processor.connect_successor(listener);
+
+    // Dispatch one at a time so every task after the first is a recycled one
+    for (int i = 1; i <= 5; ++i) {
+        source.update_value(i);
+
+        auto start = std::chrono::steady_clock::now();
+        while (received.size() < static_cast<std::size_t>(i)) {
+            mgr.update();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            if (std::chrono::steady_clock::now() - start > std::chrono::seconds(5)) break;
+        }
+    }
+
+    EXPECT_EQ(received, (std::vector<int>{10, 20, 30, 40, 50}));
+    EXPECT_EQ(processor.get_dispatched(), 0);
+}
+
+namespace {
+    // Pushes 1..5 while the first task is blocked, then returns the values that reached the listener in order
+    std::vector<int> run_backpressure(const async_backpressure& backpressure, std::size_t expected_depth, std::size_t expected_dropped) {
+        manager mgr;
+        auto& source = mgr.add_node<provider_cached<int>>();
+
+        std::atomic<bool> gate_open = false;
+        auto& processor = mgr.add_node(make_async_transformer(
+            propagate_type::eager,
+            async_type::async_all,
+            [&](int v) -> int {
+                while (!gate_open.load()) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+                return v;
+            }
+        ));
+        processor.set_backpressure(backpressure);
+
+        std::vector<int> received;
+        auto& listener = mgr.add_node(make_listener([&](int v){
+            received.push_back(v);
+        }));
+
+        source.connect_successor(processor);
+        processor.connect_successor(listener);
+
+        for (int i = 1; i <= 5; ++i) {
+            source.update_value(i);
+        }
+
+        EXPECT_EQ(processor.get_dispatched(), 1u);
+        EXPECT_EQ(processor.get_queue_depth(), expected_depth);
+        EXPECT_EQ(processor.get_dropped_count(), expected_dropped);
+        EXPECT_TRUE(processor.is_saturated());
+
+        gate_open.store(true);
+        const std::size_t expected_count = 1 + expected_depth;
+        auto start = std::chrono::steady_clock::now();
+        while (received.size() < expected_count || processor.get_dispatched() > 0) {
+            mgr.update();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            if (std::chrono::steady_clock::now() - start > std::chrono::seconds(5)) break;
+        }
+
+        EXPECT_EQ(processor.get_queue_depth(), 0u);
+        return received;
+    }
+}
+
+TEST(AsyncNodeTest, BackpressureDropNewest) {
+    const auto received = run_backpressure({.max_in_flight = 1, .queue_capacity = 2, .policy = backpressure_policy::drop_newest}, 2, 2);
+    EXPECT_EQ(received, (std::vector<int>{1, 2, 3}));
+}
+
+TEST(AsyncNodeTest, BackpressureDropOldest) {
+    const auto received = run_backpressure({.max_in_flight = 1, .queue_capacity = 2, .policy = backpressure_policy::drop_oldest}, 2, 2);
+    EXPECT_EQ(received, (std::vector<int>{1, 4, 5}));
+}
+
+TEST(AsyncNodeTest, BackpressureCoalesce) {
+    const auto received = run_backpressure({.max_in_flight = 1, .policy = backpressure_policy::coalesce}, 1, 3);
+    EXPECT_EQ(received, (std::vector<int>{1, 5}));
+}
+
+TEST(AsyncNodeTest, CoroutineSleepDoesNotHoldWorker) {
+    manager mgr{manager_config{.async_worker_count = 1}};
+    auto& source = mgr.add_node<provider_cached<int>>();
+
+    std::atomic<int> sleeping = 0;
+    std::atomic<int> max_sleeping = 0;
+    auto& processor = mgr.add_node(make_coro_transformer(
+        propagate_type::eager,
+        async_type::async_all,
+        [&](coro_context ctx, int v) -> coro_task<int> {
+            co_await ctx.schedule();
+            const int cur = ++sleeping;
+            int expected = max_sleeping.load();
+            while (expected < cur && !max_sleeping.compare_exchange_weak(expected, cur)) {}
+
+            co_await ctx.sleep_for(std::chrono::milliseconds(50));
+            --sleeping;
+            co_return v * 2;
+        }
+    ));
+
+    std::vector<int> received;
+    auto& listener = mgr.add_node(make_listener([&](int v){
+        received.push_back(v);
+    }));
+
+    source.connect_successor(processor);
+    processor.connect_successor(listener);
+
+    for (int i = 1; i <= 8; ++i) {
+        source.update_value(i);
+    }
+    EXPECT_EQ(processor.get_dispatched(), 8u);
+
+    auto start = std::chrono::steady_clock::now();
+    while (received.size() < 8) {
+        mgr.update();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        if (std::chrono::steady_clock::now() - start > std::chrono::seconds(5)) break;
+    }
+
+    ASSERT_EQ(received.size(), 8u);
+    std::ranges::sort(received);
+    EXPECT_EQ(received, (std::vector<int>{2, 4, 6, 8, 10, 12, 14, 16}));
+    // A blocking sleep would have kept the single worker busy, coroutines sleep side by side
+    EXPECT_GT(max_sleeping.load(), 1);
+    EXPECT_EQ(processor.get_dispatched(), 0u);
+}
+
+TEST(AsyncNodeTest, CoroutineCancelWakesSleep) {
+    manager mgr;
+    auto& source = mgr.add_node<provider_cached<int>>();
+
+    auto& processor = mgr.add_node(make_coro_transformer(
+        [](coro_context ctx, int v) -> coro_task<int> {
+            if (!co_await ctx.sleep_for(std::chrono::seconds(30))) {
+                co_return -1;
+            }
+            co_return v;
+        }
+    ));
+
+    std::atomic<int> result = 0;
+    auto& listener = mgr.add_node(make_listener([&](int v){
+        result = v;
+    }));
+
+    source.connect_successor(processor);
+    processor.connect_successor(listener);
+
+    source.update_value(10);
+    mgr.update();
+    EXPECT_EQ(processor.get_dispatched(), 1u);
+    EXPECT_EQ(mgr.get_scheduled_count(), 1u);
+
+    EXPECT_TRUE(processor.async_cancel());
+
+    auto start = std::chrono::steady_clock::now();
+    while (result == 0) {
+        mgr.update();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        if (std::chrono::steady_clock::now() - start > std::chrono::seconds(5)) break;
+    }
+
+    EXPECT_EQ(result, -1);
+    EXPECT_EQ(processor.get_dispatched(), 0u);
+}
+
+TEST(AsyncNodeTest, CoroutineWithoutAsyncWorkers) {
+    manager mgr{manager_no_async};
+    auto& source = mgr.add_node<provider_cached<int>>();
+
+    auto& processor = mgr.add_node(make_coro_transformer(
+        [](coro_context ctx, int v) -> coro_task<int> {
+            co_await ctx.schedule();
+            co_await ctx.resume_on_manager();
+            co_return v + 1;
+        }
+    ));
+    auto& sleeper = mgr.add_node(make_coro_transformer(
+        [](coro_context ctx, int v) -> coro_task<int> {
+            co_await ctx.sleep_for(std::chrono::milliseconds(1));
+            co_return v * 10;
+        }
+    ));
+
+    std::vector<int> received;
+    auto& listener = mgr.add_node(make_listener([&](int v){
+        received.push_back(v);
+    }));
+
+    source.connect_successor(processor);
+    processor.connect_successor(sleeper);
+    sleeper.connect_successor(listener);
+
+    // Nothing suspends in processor, its result is delivered during the push
+    source.update_value(1);
+    EXPECT_EQ(processor.get_dispatched(), 0u);
+    EXPECT_EQ(sleeper.get_dispatched(), 1u);
+    EXPECT_TRUE(received.empty());
+
+    auto start = std::chrono::steady_clock::now();
+    while (received.empty()) {
+        mgr.update();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        if (std::chrono::steady_clock::now() - start > std::chrono::seconds(5)) break;
+    }
+    EXPECT_EQ(received, (std::vector<int>{20}));
+}
+
+TEST(AsyncNodeTest, ScheduledActsRunInDeadlineOrder) {
+    manager mgr{manager_no_async};
+    const auto now = std::chrono::steady_clock::now();
+
+    std::vector<int> order;
+    mgr.post_at(now + std::chrono::milliseconds(2), [&]{ order.push_back(2); });
+    mgr.post_at(now, [&]{ order.push_back(0); });
+    mgr.post_at(now, [&]{ order.push_back(1); });
+    mgr.post_at(now + std::chrono::hours(1), [&]{ order.push_back(3); });
+
+    EXPECT_EQ(mgr.get_next_scheduled_time(), now);
+
+    auto start = std::chrono::steady_clock::now();
+    while (order.size() < 3) {
+        mgr.update();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        if (std::chrono::steady_clock::now() - start > std::chrono::seconds(5)) break;
+    }
+
+    EXPECT_EQ(order, (std::vector<int>{0, 1, 2}));
+    EXPECT_EQ(mgr.get_scheduled_count(), 1u);
+}
+
+TEST(AsyncNodeTest, SupersededTasksAreSkipped) {
+    manager mgr{manager_config{.async_worker_count = 1}};
+    auto& source = mgr.add_node<provider_cached<int>>();
+
+    std::atomic<bool> gate_open = false;
+    std::atomic<int> executed = 0;
+    auto& processor = mgr.add_node(make_async_transformer(
+        propagate_type::eager,
+        async_type::async_latest,
+        [&](int v) -> int {
+            ++executed;
+            while (!gate_open.load()) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            return v;
+        }
+    ));
+
+    int last_value = 0;
+    auto& listener = mgr.add_node(make_listener([&](int v){
+        last_value = v;
+    }));
+
+    source.connect_successor(processor);
+    processor.connect_successor(listener);
+
+    source.update_value(1);
+    auto start = std::chrono::steady_clock::now();
+    while (executed == 0 && std::chrono::steady_clock::now() - start < std::chrono::seconds(5)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    // Queued behind the blocked task, each one supersedes the previous
+    for (int i = 2; i <= 6; ++i) {
+        source.update_value(i);
+    }
+    gate_open = true;
+
+    start = std::chrono::steady_clock::now();
+    while ((last_value != 6 || processor.get_dispatched() > 0) && std::chrono::steady_clock::now() - start < std::chrono::seconds(5)) {
+        mgr.wait_and_update(std::chrono::milliseconds(100));
+    }
+
+    EXPECT_EQ(last_value, 6);
+    EXPECT_EQ(executed, 2);
+    EXPECT_EQ(mgr.get_skipped_task_count(), 4u);
+    EXPECT_EQ(mgr.stats().async.skipped, 4u);
+    EXPECT_EQ(processor.get_dispatched(), 0u);
+}
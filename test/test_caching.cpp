@@ -42,3 +42,46 @@ TEST(CachingTest, TerminalCached) {
     EXPECT_EQ(term.request_cache(), 10);
     EXPECT_EQ(compute_count, 1); // Stays same!
 }
+
+TEST(CachingTest, SharedAncestorFetchedOnce) {
+    manager mgr;
+    auto& p = mgr.add_node<provider_cached<int>>();
+
+    int shared_count = 0;
+    auto& shared = mgr.add_node(make_transformer(propagate_type::lazy, [&](int v){
+        shared_count++;
+        return v + 1;
+    }));
+
+    auto& lhs = mgr.add_node(make_transformer(propagate_type::lazy, [](int v){
+        return v * 2;
+    }));
+    auto& rhs = mgr.add_node(make_transformer(propagate_type::lazy, [](int v){
+        return v * 3;
+    }));
+
+    auto& join = mgr.add_node(make_transformer(propagate_type::lazy, [](int a, int b){
+        return a + b;
+    }));
+
+    auto& term = mgr.add_node<terminal_cached<int>>(propagate_type::lazy);
+
+    p.connect_successor(shared);
+    shared.connect_successor(lhs);
+    shared.connect_successor(rhs);
+    join.connect_predecessor(0, lhs);
+    join.connect_predecessor(1, rhs);
+    join.connect_successor(term);
+
+    p.update_value(1);
+    EXPECT_EQ(shared_count, 0);
+
+    // Both paths reach `shared`, it should only be computed once per fetch
+    EXPECT_EQ(term.request_cache(), 2 * 2 + 2 * 3);
+    EXPECT_EQ(shared_count, 1);
+
+    // Memo is released after the fetch, a new update is observed
+    p.update_value(2);
+    EXPECT_EQ(term.request_cache(), 3 * 2 + 3 * 3);
+    EXPECT_EQ(shared_count, 2);
+}
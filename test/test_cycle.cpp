@@ -61,3 +61,39 @@ TEST(CycleTest, LargerCycle) {
         FAIL() << "Expected invalid_node exception";
     }
 }
+
+TEST(CycleTest, DeepChainCycle) {
+    manager mgr;
+    constexpr std::size_t depth = 100000;
+
+    std::vector<node*> chain;
+    chain.reserve(depth);
+    for (std::size_t i = 0; i < depth; ++i) {
+        chain.push_back(&mgr.add_node(make_transformer(propagate_type::eager, [](int v){ return v; })));
+    }
+
+    connect_chain(chain);
+    EXPECT_EQ(chain.back()->get_topological_rank(), depth - 1);
+
+    // Closing the chain must not overflow the stack
+    EXPECT_THROW(chain.back()->connect_successor(*chain.front()), invalid_node_error);
+}
+
+TEST(CycleTest, DiamondIsNotCycle) {
+    manager mgr;
+    auto& src = mgr.add_node(make_transformer(propagate_type::eager, [](int v){ return v; }));
+    auto& lhs = mgr.add_node(make_transformer(propagate_type::eager, [](int v){ return v; }));
+    auto& rhs = mgr.add_node(make_transformer(propagate_type::eager, [](int v){ return v; }));
+    auto& join = mgr.add_node(make_transformer(propagate_type::eager, [](int a, int b){ return a + b; }));
+
+    // Connect against the topological order so ranks have to be raised
+    join.connect_predecessor(0, lhs);
+    join.connect_predecessor(1, rhs);
+    EXPECT_NO_THROW(src.connect_successor(lhs));
+    EXPECT_NO_THROW(src.connect_successor(rhs));
+
+    EXPECT_LT(src.get_topological_rank(), lhs.get_topological_rank());
+    EXPECT_LT(lhs.get_topological_rank(), join.get_topological_rank());
+
+    EXPECT_THROW(join.connect_successor(src), invalid_node_error);
+}
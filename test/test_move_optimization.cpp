@@ -203,3 +203,134 @@ TEST(MoveOptimizationTest, ProviderGeneralConsumesRvalueCarrier) {
     EXPECT_TRUE(listener.updated);
     EXPECT_EQ(listener.last_value, "payload");
 }
+
+TEST(MoveOptimizationTest, SharedValueFanOutDoesNotCopy) {
+    manager mgr;
+    auto& provider = mgr.add_node<provider_general<shared_value<MoveTracker>>>();
+
+    std::vector<const MoveTracker*> seen;
+    for(int i = 0; i < 3; ++i) {
+        auto& listener = mgr.add_node(make_listener([&](const shared_value<MoveTracker>& v){
+            seen.push_back(std::addressof(*v));
+        }));
+        provider.connect_successor(listener);
+    }
+
+    shared_value<MoveTracker> source{std::in_place, "payload"};
+    MoveTracker::reset();
+    provider.update_value(std::move(source));
+
+    ASSERT_EQ(seen.size(), 3u);
+    EXPECT_EQ(seen[0], seen[1]);
+    EXPECT_EQ(seen[1], seen[2]);
+    EXPECT_EQ(MoveTracker::copy_count, 0);
+}
+
+TEST(MoveOptimizationTest, SharedValueCopiesOnlyOnMutation) {
+    manager mgr;
+    auto& provider = mgr.add_node<provider_cached<shared_value<MoveTracker>>>();
+
+    auto& mutating = mgr.add_node(make_transformer([](shared_value<MoveTracker> v){
+        v.mutate().value += "-changed";
+        return v->value;
+    }));
+    auto& reading = mgr.add_node(make_transformer([](const shared_value<MoveTracker>& v){
+        return v->value;
+    }));
+
+    std::string mutated;
+    std::string read;
+    auto& l1 = mgr.add_node(make_listener([&](std::string s){ mutated = std::move(s); }));
+    auto& l2 = mgr.add_node(make_listener([&](std::string s){ read = std::move(s); }));
+
+    provider.connect_successor(mutating);
+    provider.connect_successor(reading);
+    mutating.connect_successor(l1);
+    reading.connect_successor(l2);
+
+    MoveTracker::reset();
+    provider.update_value(shared_value<MoveTracker>{std::in_place, "payload"});
+
+    EXPECT_EQ(mutated, "payload-changed");
+    EXPECT_EQ(read, "payload");
+    // the provider cache still shares the snapshot, so exactly the mutating consumer copies
+    EXPECT_EQ(MoveTracker::copy_count, 1);
+}
+
+TEST(MoveOptimizationTest, SharedValueDescriptorUnwrapsUniqueWithoutCopy) {
+    manager mgr;
+    auto& provider = mgr.add_node<provider_general<shared_value<MoveTracker>>>();
+
+    auto& unwrap = mgr.add_node(make_transformer<descriptor<shared_value<MoveTracker>, {}, MoveTracker>>([](MoveTracker v){
+        return v.value;
+    }));
+
+    std::string received;
+    auto& listener = mgr.add_node(make_listener([&](std::string s){ received = std::move(s); }));
+
+    provider.connect_successor(unwrap);
+    unwrap.connect_successor(listener);
+
+    MoveTracker::reset();
+    provider.update_value(shared_value<MoveTracker>{std::in_place, "payload"});
+
+    EXPECT_EQ(received, "payload");
+    EXPECT_EQ(MoveTracker::copy_count, 0);
+}
+
+TEST(MoveOptimizationTest, InplaceTransformerReusesBuffer) {
+    manager mgr;
+    auto& provider = mgr.add_node<provider_cached<std::vector<int>>>();
+
+    auto& doubled = mgr.add_node(make_inplace_transformer([](std::vector<int>& out, const std::vector<int>& in){
+        out.resize(in.size());
+        std::ranges::transform(in, out.begin(), [](int v){ return v * 2; });
+    }));
+
+    std::vector<const int*> seen_data;
+    int sum = 0;
+    auto& reader = mgr.add_node(make_listener([&](const std::vector<int>& v){
+        seen_data.push_back(v.data());
+        sum = std::ranges::fold_left(v, 0, std::plus{});
+    }));
+
+    std::vector<int> owned;
+    auto& owner = mgr.add_node(make_listener([&](std::vector<int> v){ owned = std::move(v); }));
+
+    provider.connect_successor(doubled);
+    doubled.connect_successor(reader);
+    doubled.connect_successor(owner);
+
+    provider.update_value(std::vector{1, 2, 3});
+    EXPECT_EQ(sum, 12);
+    EXPECT_EQ(owned, (std::vector{2, 4, 6}));
+
+    provider.update_value(std::vector{3, 2, 1});
+    EXPECT_EQ(sum, 12);
+    EXPECT_EQ(owned, (std::vector{6, 4, 2}));
+
+    // the consumer taking ownership copied, the node buffer kept its storage
+    ASSERT_EQ(seen_data.size(), 2u);
+    EXPECT_EQ(seen_data[0], seen_data[1]);
+    EXPECT_EQ(seen_data[1], doubled.get_buffer().data());
+}
+
+TEST(MoveOptimizationTest, InplaceTransformerLazyFetch) {
+    manager mgr;
+    auto& provider = mgr.add_node<provider_cached<int>>();
+
+    auto& text = mgr.add_node(make_inplace_transformer(propagate_type::lazy, [](std::string& out, int v){
+        out.assign(static_cast<std::size_t>(v), 'x');
+    }));
+
+    auto& term = mgr.add_node<terminal_cached<std::string>>(propagate_type::lazy);
+
+    provider.connect_successor(text);
+    text.connect_successor(term);
+
+    provider.update_value(3);
+    EXPECT_EQ(term.request_cache(), "xxx");
+
+    provider.update_value(5);
+    EXPECT_EQ(term.request_cache(), "xxxxx");
+}
@@ -69,3 +69,400 @@ TEST(MultithreadingTest, MultipleThreads) {
 
     EXPECT_EQ(sum.load(), num_threads);
 }
+
+TEST(MultithreadingTest, ParallelFanOut) {
+    manager mgr{manager_no_async};
+    auto& p = mgr.add_node<provider_cached<int>>();
+    p.set_parallel_fan_out(true);
+
+    constexpr int branch_count = 4;
+    std::array<std::atomic<int>, branch_count> results{};
+    std::mutex ids_mutex;
+    std::set<std::thread::id> ids;
+
+    for(int i = 0; i < branch_count; ++i) {
+        auto& t = mgr.add_node(make_transformer([&, i](int v){
+            {
+                std::lock_guard _{ids_mutex};
+                ids.insert(std::this_thread::get_id());
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            return v * (i + 1);
+        }));
+        auto& l = mgr.add_node(make_listener([&, i](int v){
+            results[i].store(v);
+        }));
+        p.connect_successor(t);
+        t.connect_successor(l);
+    }
+
+    p.update_value(10);
+
+    // joined before update_value returns
+    for(int i = 0; i < branch_count; ++i) {
+        EXPECT_EQ(results[i].load(), 10 * (i + 1));
+    }
+    if(std::thread::hardware_concurrency() > 1) {
+        EXPECT_GT(ids.size(), 1u);
+    }
+}
+
+TEST(MultithreadingTest, ParallelFanOutFallsBackOnSharedJoin) {
+    manager mgr{manager_no_async};
+    auto& p = mgr.add_node<provider_cached<int>>();
+    p.set_parallel_fan_out(true);
+
+    std::set<std::thread::id> ids;
+    auto record = [&](int v){
+        ids.insert(std::this_thread::get_id());
+        return v;
+    };
+    auto& a = mgr.add_node(make_transformer(record));
+    auto& b = mgr.add_node(make_transformer(record));
+
+    int sum = 0;
+    auto& join = mgr.add_node(make_transformer([&](int x, int y){
+        ids.insert(std::this_thread::get_id());
+        return x + y;
+    }));
+    auto& l = mgr.add_node(make_listener([&](int v){ sum = v; }));
+
+    p.connect_successor(a);
+    p.connect_successor(b);
+    a.connect_successor(0, join);
+    b.connect_successor(1, join);
+    join.connect_successor(l);
+
+    p.update_value(5);
+
+    EXPECT_EQ(sum, 10);
+    ASSERT_EQ(ids.size(), 1u);
+    EXPECT_EQ(*ids.begin(), std::this_thread::get_id());
+}
+
+TEST(MultithreadingTest, ParallelFanOutFallsBackOnUncachedSource) {
+    manager mgr{manager_no_async};
+    auto& p = mgr.add_node<provider_cached<int>>();
+
+    // uncached, every branch reading it would recompute and memoize it on its own thread
+    int source_computations = 0;
+    auto& source = mgr.add_node(make_transformer([&](int v){
+        ++source_computations;
+        return v + 1;
+    }));
+    source.set_parallel_fan_out(true);
+    p.connect_successor(source);
+
+    constexpr int branch_count = 4;
+    std::set<std::thread::id> ids;
+    std::array<int, branch_count> results{};
+
+    for(int i = 0; i < branch_count; ++i) {
+        auto& t = mgr.add_node(make_transformer([&, i](int v){
+            ids.insert(std::this_thread::get_id());
+            return v * (i + 1);
+        }));
+        auto& l = mgr.add_node(make_listener([&, i](int v){
+            results[i] = v;
+        }));
+        source.connect_successor(t);
+        t.connect_successor(l);
+    }
+
+    p.update_value(10);
+
+    EXPECT_EQ(source_computations, 1);
+    ASSERT_EQ(ids.size(), 1u);
+    EXPECT_EQ(*ids.begin(), std::this_thread::get_id());
+    for(int i = 0; i < branch_count; ++i) {
+        EXPECT_EQ(results[i], 11 * (i + 1));
+    }
+}
+
+TEST(MultithreadingTest, ParallelFanOutFallsBackOnPulseNodes) {
+    manager mgr{manager_no_async};
+    auto& p = mgr.add_node<provider_cached<int>>();
+    p.set_parallel_fan_out(true);
+
+    constexpr int branch_count = 4;
+    std::set<std::thread::id> ids;
+    std::vector<terminal_cached<int>*> terms;
+
+    for(int i = 0; i < branch_count; ++i) {
+        auto& t = mgr.add_node(make_transformer([&, i](int v){
+            ids.insert(std::this_thread::get_id());
+            return v * (i + 1);
+        }));
+        // pulse nodes share the pending list of their group
+        auto& term = mgr.add_node<terminal_cached<int>>(propagate_type::pulse);
+        p.connect_successor(t);
+        t.connect_successor(term);
+        terms.push_back(&term);
+    }
+
+    p.update_value(10);
+
+    ASSERT_EQ(ids.size(), 1u);
+    EXPECT_EQ(*ids.begin(), std::this_thread::get_id());
+    EXPECT_EQ(mgr.get_default_pulse_group().get_pending_count(), static_cast<std::size_t>(branch_count));
+
+    mgr.update();
+    for(int i = 0; i < branch_count; ++i) {
+        EXPECT_EQ(terms[i]->request_cache(), 10 * (i + 1));
+    }
+}
+
+TEST(MultithreadingTest, ConcurrentProviderKeepsLatest) {
+    manager mgr{manager_no_async};
+    auto& p = mgr.add_node<provider_concurrent<int>>();
+
+    std::vector<int> received;
+    auto& t = mgr.add_node(make_listener([&](int v){
+        received.push_back(v);
+    }));
+    p.connect_successor(t);
+
+    std::jthread{[&]{
+        for (int i = 1; i <= 1000; ++i) {
+            p.post_value(i);
+        }
+    }}.join();
+
+    EXPECT_TRUE(received.empty());
+    mgr.update();
+    ASSERT_EQ(received.size(), 1u);
+    EXPECT_EQ(received.back(), 1000);
+    EXPECT_EQ(p.get_raw_cache(), 1000);
+
+    // Nothing posted since the last drain
+    mgr.update();
+    EXPECT_EQ(received.size(), 1u);
+}
+
+TEST(MultithreadingTest, ConcurrentProviderQueueKeepsAll) {
+    manager mgr{manager_no_async};
+    auto& p = mgr.add_node<provider_concurrent_queue<int>>(8);
+    EXPECT_EQ(p.get_capacity(), 8u);
+
+    std::vector<int> received;
+    auto& t = mgr.add_node(make_listener([&](int v){
+        received.push_back(v);
+    }));
+    p.connect_successor(t);
+
+    // stopped if the consumer gives up, so a full ring fails the test instead of hanging the join
+    std::jthread producer([&](std::stop_token stop){
+        for (int i = 0; i < 100; ++i) {
+            while (!p.try_post_value(i)) {
+                if (stop.stop_requested()) return;
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    auto start = std::chrono::steady_clock::now();
+    while (received.size() < 100 && std::chrono::steady_clock::now() - start < std::chrono::seconds(2)) {
+        mgr.update();
+    }
+    producer.request_stop();
+    producer.join();
+    mgr.update();
+
+    ASSERT_EQ(received.size(), 100u);
+    EXPECT_TRUE(std::ranges::equal(received, std::views::iota(0, 100)));
+}
+
+TEST(MultithreadingTest, ConcurrentProvidersOutliveManager) {
+    provider_concurrent<int>* latest = nullptr;
+    provider_concurrent_queue<int>* queue = nullptr;
+    node_pointer latest_ref;
+    node_pointer queue_ref;
+    {
+        manager mgr{manager_no_async};
+        latest = &mgr.add_node<provider_concurrent<int>>();
+        queue = &mgr.add_node<provider_concurrent_queue<int>>(8);
+        latest_ref = node_pointer(*latest);
+        queue_ref = node_pointer(*queue);
+
+        // queued in the dirty list, never drained
+        latest->post_value(1);
+        EXPECT_TRUE(queue->try_post_value(1));
+    }
+
+    EXPECT_FALSE(latest->is_queued());
+    EXPECT_FALSE(queue->is_queued());
+
+    // writes after the manager is gone never reach it
+    std::jthread{[&]{
+        latest->post_value(2);
+        EXPECT_FALSE(queue->try_post_value(2));
+    }}.join();
+    EXPECT_FALSE(latest->is_queued());
+
+    latest_ref.reset();
+    queue_ref.reset();
+}
+
+TEST(MultithreadingTest, ConcurrentProvidersCommitTogether) {
+    manager mgr{manager_no_async};
+    auto& lhs = mgr.add_node<provider_concurrent<int>>();
+    auto& rhs = mgr.add_node<provider_concurrent<int>>();
+
+    int computations = 0;
+    auto& join = mgr.add_node(make_transformer([&](int a, int b){
+        ++computations;
+        return a + b;
+    }));
+    join.connect_predecessor(0, lhs);
+    join.connect_predecessor(1, rhs);
+
+    int result = 0;
+    auto& listener = mgr.add_node(make_listener([&](int v){
+        result = v;
+    }));
+    join.connect_successor(listener);
+
+    lhs.post_value(1);
+    rhs.post_value(2);
+    mgr.update();
+
+    EXPECT_EQ(result, 3);
+    EXPECT_EQ(computations, 1);
+}
+
+TEST(MultithreadingTest, PostedActsKeepPerThreadOrderOnOverflow) {
+    // A tiny ring forces most acts into the overflow list
+    manager mgr{manager_config{.posted_act_capacity = 4}};
+
+    constexpr int num_threads = 4;
+    constexpr int acts_per_thread = 500;
+    std::array<std::vector<int>, num_threads> received;
+
+    {
+        std::vector<std::jthread> producers;
+        for (int t = 0; t < num_threads; ++t) {
+            producers.emplace_back([&, t]{
+                for (int i = 0; i < acts_per_thread; ++i) {
+                    mgr.push_posted_act([&received, t, i]{
+                        received[t].push_back(i);
+                    });
+                }
+            });
+        }
+
+        // Drain while producing
+        for (int i = 0; i < 50; ++i) {
+            mgr.update();
+        }
+    }
+    mgr.update();
+
+    for (const auto& values : received) {
+        ASSERT_EQ(values.size(), static_cast<std::size_t>(acts_per_thread));
+        EXPECT_TRUE(std::ranges::equal(values, std::views::iota(0, acts_per_thread)));
+    }
+}
+
+TEST(MultithreadingTest, PostedActsWithLargeCapture) {
+    manager mgr{manager_no_async};
+
+    std::array<int, 64> payload{};
+    payload.back() = 7;
+
+    int received = 0;
+    std::jthread{[&]{
+        mgr.push_posted_act([&received, payload]{
+            received = payload.back();
+        });
+    }}.join();
+
+    mgr.update();
+    EXPECT_EQ(received, 7);
+}
+
+TEST(MultithreadingTest, WaitAndUpdateWakesOnPostedAct) {
+    manager mgr;
+    auto& p = mgr.add_node<provider_cached<int>>();
+
+    std::atomic<int> received_value = 0;
+    auto& t = mgr.add_node(make_listener([&](int v){
+        received_value.store(v);
+    }));
+    p.connect_successor(t);
+
+    std::jthread worker([&]{
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        mgr.push_posted_act([&]{
+            p.update_value(100);
+        });
+    });
+
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_TRUE(mgr.wait_and_update(std::chrono::seconds(10)));
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+    EXPECT_EQ(received_value.load(), 100);
+}
+
+TEST(MultithreadingTest, WaitAndUpdateWakesOnAsyncCompletion) {
+    manager mgr;
+    auto& p = mgr.add_node<provider_cached<int>>();
+    auto& async = mgr.add_node(make_async_transformer([](int v){
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        return v * 2;
+    }));
+
+    int received_value = 0;
+    auto& t = mgr.add_node(make_listener([&](int v){
+        received_value = v;
+    }));
+    p.connect_successor(async);
+    async.connect_successor(t);
+
+    p.update_value(21);
+
+    const auto start = std::chrono::steady_clock::now();
+    while (received_value == 0 && std::chrono::steady_clock::now() - start < std::chrono::seconds(5)) {
+        mgr.wait_and_update(std::chrono::seconds(5));
+    }
+    EXPECT_EQ(received_value, 42);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+}
+
+TEST(MultithreadingTest, WaitAndUpdateTimesOut) {
+    manager mgr;
+
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(mgr.wait_and_update(std::chrono::milliseconds(20)));
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(20));
+
+    // Scheduled acts shorten the wait
+    bool fired = false;
+    mgr.post_after(std::chrono::milliseconds(5), [&]{ fired = true; });
+    EXPECT_TRUE(mgr.wait_and_update(std::chrono::seconds(10)));
+    EXPECT_TRUE(fired);
+}
+
+TEST(MultithreadingTest, RunUntilStopRequested) {
+    manager mgr;
+    std::stop_source stop;
+
+    int processed = 0;
+    std::jthread producer([&]{
+        for (int i = 0; i < 100; ++i) {
+            mgr.push_posted_act([&]{ ++processed; });
+        }
+        mgr.push_posted_act([&]{ stop.request_stop(); });
+    });
+
+    mgr.run_until(stop.get_token());
+    EXPECT_EQ(processed, 100);
+
+    // A stop request from another thread wakes an idle manager
+    std::stop_source idle_stop;
+    std::jthread stopper([&]{
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        idle_stop.request_stop();
+    });
+    mgr.run_until(idle_stop.get_token());
+    EXPECT_TRUE(idle_stop.stop_requested());
+}
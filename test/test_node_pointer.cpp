@@ -137,3 +137,105 @@ TEST(NodePointerTest, Equality) {
     EXPECT_NE(ptr1, ptr3);
     EXPECT_EQ(ptr1, ptr1);
 }
+
+TEST(NodePointerTest, ArenaAllocation) {
+    bool destroyed = false;
+    node_pointer escaped;
+    {
+        manager mgr;
+        node_arena& arena = mgr.get_node_arena();
+
+        auto& n = mgr.add_node<MockNode>(&destroyed);
+        EXPECT_EQ(n.get_arena(), &arena);
+        EXPECT_EQ(arena.get_reference_count(), 2); // manager + node
+
+        escaped = node_pointer(n);
+    } // manager released, the node keeps the arena alive
+
+    EXPECT_FALSE(destroyed);
+    ASSERT_NE(escaped->get_arena(), nullptr);
+    EXPECT_EQ(escaped->get_arena()->get_reference_count(), 1);
+
+    escaped.reset();
+    EXPECT_TRUE(destroyed);
+}
+
+TEST(NodePointerTest, ArenaAndHeapNodesCoexist) {
+    bool destroyed = false;
+    manager mgr;
+    node_pointer ptr = node_pointer::make_in_arena<MockNode>(mgr.get_node_arena(), &destroyed);
+    EXPECT_EQ(ptr->get_arena(), &mgr.get_node_arena());
+
+    bool other_destroyed = false;
+    node_pointer heap(new MockNode(&other_destroyed));
+    EXPECT_EQ(heap->get_arena(), nullptr);
+
+    ptr.reset();
+    heap.reset();
+    EXPECT_TRUE(destroyed);
+    EXPECT_TRUE(other_destroyed);
+}
+
+TEST(NodePointerTest, HandlesSurviveOtherRemovals) {
+    manager mgr{manager_no_async};
+
+    bool a_destroyed = false;
+    bool b_destroyed = false;
+    auto& a = mgr.add_node<MockNode>(&a_destroyed);
+    auto& b = mgr.add_node<MockNode>(&b_destroyed);
+    auto& c = mgr.add_node<MockNode>(nullptr);
+
+    const node_handle ha = mgr.get_handle(a);
+    const node_handle hb = mgr.get_handle(b);
+    const node_handle hc = mgr.get_handle(c);
+    ASSERT_TRUE(ha);
+    EXPECT_EQ(mgr.get_node_count(), 3u);
+
+    EXPECT_TRUE(mgr.erase_node(a));
+    EXPECT_FALSE(mgr.erase_node(a)); // already queued
+    EXPECT_EQ(mgr.find_node(ha), &a); // removed on update
+    mgr.update();
+
+    EXPECT_TRUE(a_destroyed);
+    EXPECT_FALSE(b_destroyed);
+    EXPECT_EQ(mgr.get_node_count(), 2u);
+    EXPECT_EQ(mgr.find_node(ha), nullptr);
+    EXPECT_EQ(mgr.find_node(hb), &b);
+    EXPECT_EQ(mgr.find_node(hc), &c);
+
+    // The freed slot is reused with a new generation, the stale handle stays invalid
+    auto& d = mgr.add_node<MockNode>(nullptr);
+    const node_handle hd = mgr.get_handle(d);
+    EXPECT_EQ(hd.index, ha.index);
+    EXPECT_NE(hd, ha);
+    EXPECT_EQ(mgr.find_node(ha), nullptr);
+    EXPECT_EQ(mgr.find_node(hd), &d);
+}
+
+TEST(NodePointerTest, MovedNodeStartsWithFreshBookkeeping) {
+    manager mgr{manager_no_async};
+
+    auto& a = mgr.add_node<provider_cached<int>>();
+    a.update_value(3);
+    EXPECT_TRUE(mgr.erase_node(a));
+
+    // Moved out of a node queued for removal, neither expired nor registered in its slot
+    auto& b = mgr.add_node(std::move(a));
+    ASSERT_NE(&a, &b);
+    EXPECT_EQ(b.get_raw_cache(), 3);
+    EXPECT_NE(mgr.get_handle(b), mgr.get_handle(a));
+    EXPECT_TRUE(mgr.erase_node(b));
+
+    mgr.update();
+    EXPECT_EQ(mgr.get_node_count(), 0u);
+}
+
+TEST(NodePointerTest, HandleOfForeignNodeIsInvalid) {
+    manager mgr{manager_no_async};
+    manager other{manager_no_async};
+
+    auto& n = other.add_node<MockNode>(nullptr);
+    EXPECT_FALSE(mgr.get_handle(n));
+    EXPECT_FALSE(mgr.erase_node(n));
+    EXPECT_EQ(mgr.find_node(node_handle{}), nullptr);
+}
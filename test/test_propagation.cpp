@@ -87,3 +87,543 @@ TEST(PropagationTest, PulsePropagation) {
     mgr.update();
     EXPECT_EQ(received_value, 55);
 }
+
+TEST(PropagationTest, TopologicalDiamondEvaluatesOnce) {
+    manager mgr;
+    auto& p = mgr.add_node<provider_cached<int>>();
+
+    int branch_count = 0;
+    auto& lhs = mgr.add_node(make_transformer([&](int v){
+        branch_count++;
+        return v + 1;
+    }));
+    auto& rhs = mgr.add_node(make_transformer([&](int v){
+        branch_count++;
+        return v * 2;
+    }));
+
+    int join_count = 0;
+    auto& join = mgr.add_node(make_transformer(propagate_type::topological, [&](int a, int b){
+        join_count++;
+        return a + b;
+    }));
+
+    std::vector<int> received;
+    auto& listener = mgr.add_node(make_listener([&](int v){
+        received.push_back(v);
+    }));
+
+    p.connect_successor(lhs);
+    p.connect_successor(rhs);
+    join.connect_predecessor(0, lhs);
+    join.connect_predecessor(1, rhs);
+    join.connect_successor(listener);
+
+    EXPECT_LT(lhs.get_topological_rank(), join.get_topological_rank());
+    EXPECT_LT(rhs.get_topological_rank(), join.get_topological_rank());
+
+    p.update_value(10);
+    EXPECT_EQ(join_count, 1);
+    EXPECT_EQ(branch_count, 2);
+    ASSERT_EQ(received.size(), 1);
+    EXPECT_EQ(received.back(), 11 + 20);
+
+    p.update_value(1);
+    EXPECT_EQ(join_count, 2);
+    EXPECT_EQ(branch_count, 4);
+    ASSERT_EQ(received.size(), 2);
+    EXPECT_EQ(received.back(), 2 + 2);
+}
+
+TEST(PropagationTest, TransactionCoalescesProviderUpdates) {
+    manager mgr;
+    auto& a = mgr.add_node<provider_cached<int>>();
+    auto& b = mgr.add_node<provider_cached<int>>();
+    auto& c = mgr.add_node<provider_cached<int>>();
+
+    int join_count = 0;
+    auto& join = mgr.add_node(make_transformer([&](int x, int y, int z){
+        join_count++;
+        return x + y + z;
+    }));
+
+    std::vector<int> received;
+    auto& listener = mgr.add_node(make_listener([&](int v){
+        received.push_back(v);
+    }));
+
+    join.connect_predecessor(0, a);
+    join.connect_predecessor(1, b);
+    join.connect_predecessor(2, c);
+    join.connect_successor(listener);
+
+    mgr.batch([&]{
+        a.update_value(1);
+        b.update_value(2);
+        c.update_value(3);
+        a.update_value(10);
+
+        // Nothing is pushed before commit
+        EXPECT_EQ(join_count, 0);
+    });
+
+    EXPECT_EQ(join_count, 1);
+    ASSERT_EQ(received.size(), 1);
+    EXPECT_EQ(received.back(), 10 + 2 + 3);
+
+    {
+        manager::transaction tx{mgr};
+        b.update_value(20);
+        c.update_value(30);
+    }
+
+    EXPECT_EQ(join_count, 2);
+    ASSERT_EQ(received.size(), 2);
+    EXPECT_EQ(received.back(), 10 + 20 + 30);
+
+    // Outside of a transaction, updates are eager again
+    a.update_value(0);
+    EXPECT_EQ(join_count, 3);
+    EXPECT_EQ(received.back(), 0 + 20 + 30);
+}
+
+TEST(PropagationTest, TransactionOnlyDefersItsOwnManager) {
+    manager outer{manager_no_async};
+    manager inner{manager_no_async};
+    auto& a = outer.add_node<provider_cached<int>>();
+    auto& b = inner.add_node<provider_cached<int>>();
+
+    std::vector<int> received_a;
+    std::vector<int> received_b;
+    auto& la = outer.add_node(make_listener([&](int v){ received_a.push_back(v); }));
+    auto& lb = inner.add_node(make_listener([&](int v){ received_b.push_back(v); }));
+    a.connect_successor(la);
+    b.connect_successor(lb);
+
+    outer.batch([&]{
+        a.update_value(1);
+        b.update_value(2);
+        EXPECT_TRUE(received_a.empty());
+        EXPECT_EQ(received_b, std::vector{2});
+
+        // A nested transaction of another manager commits on its own
+        inner.batch([&]{
+            b.update_value(3);
+            EXPECT_EQ(received_b, std::vector{2});
+        });
+        EXPECT_EQ(received_b, (std::vector{2, 3}));
+        EXPECT_TRUE(received_a.empty());
+    });
+
+    EXPECT_EQ(received_a, std::vector{1});
+}
+
+TEST(PropagationTest, DistinctOutputStopsPropagation) {
+    manager mgr;
+    auto& p = mgr.add_node<provider_cached<int>>();
+
+    // uncached, compared against a copy of the last output
+    auto& clamp = mgr.add_node(make_transformer<int>(std::in_place_type<descriptor<int, {.distinct = true}>>, [](int v){
+        return std::clamp(v, 0, 10);
+    }));
+
+    // cached, compared against the cache
+    auto& half = mgr.add_node(make_transformer<int>(std::in_place_type<descriptor<int, {.cache = true, .distinct = true}>>, [](int v){
+        return v / 2;
+    }));
+
+    int clamp_pushes = 0;
+    int half_pushes = 0;
+    auto& l1 = mgr.add_node(make_listener([&](int){ ++clamp_pushes; }));
+    auto& l2 = mgr.add_node(make_listener([&](int){ ++half_pushes; }));
+
+    p.connect_successor(clamp);
+    clamp.connect_successor(half);
+    clamp.connect_successor(l1);
+    half.connect_successor(l2);
+
+    p.update_value(8);
+    EXPECT_EQ(clamp_pushes, 1);
+    EXPECT_EQ(half_pushes, 1);
+
+    p.update_value(8);
+    EXPECT_EQ(clamp_pushes, 1);
+    EXPECT_EQ(half_pushes, 1);
+
+    p.update_value(9); // 9 / 2 == 8 / 2
+    EXPECT_EQ(clamp_pushes, 2);
+    EXPECT_EQ(half_pushes, 1);
+
+    p.update_value(30);
+    EXPECT_EQ(clamp_pushes, 3);
+    EXPECT_EQ(half_pushes, 2);
+
+    p.update_value(40); // clamped to 10 again
+    EXPECT_EQ(clamp_pushes, 3);
+    EXPECT_EQ(half_pushes, 2);
+}
+
+struct colliding_key {
+    int value;
+    bool operator==(const colliding_key&) const = default;
+};
+
+template <>
+struct std::hash<colliding_key> {
+    std::size_t operator()(const colliding_key&) const noexcept { return 0; }
+};
+
+TEST(PropagationTest, DistinctIgnoresStdHashCollisions) {
+    manager mgr;
+    auto& p = mgr.add_node<provider_cached<int>>();
+
+    // only a distinct_hash specialization opts into hash comparison
+    auto& key = mgr.add_node(make_transformer<int>(std::in_place_type<descriptor<colliding_key, {.distinct = true}>>, [](int v){
+        return colliding_key{v};
+    }));
+
+    std::vector<int> received;
+    auto& l = mgr.add_node(make_listener([&](const colliding_key& k){ received.push_back(k.value); }));
+    p.connect_successor(key);
+    key.connect_successor(l);
+
+    p.update_value(1);
+    p.update_value(2);
+    p.update_value(2);
+    EXPECT_EQ(received, (std::vector{1, 2}));
+}
+
+TEST(PropagationTest, DistinctProviderSkipsEqualValues) {
+    manager mgr;
+    auto& p = mgr.add_node<provider_cached<std::string>>();
+    p.set_distinct(true);
+
+    int pushes = 0;
+    auto& l = mgr.add_node(make_listener([&](const std::string&){ ++pushes; }));
+    p.connect_successor(l);
+
+    p.update_value(std::string{"a"});
+    p.update_value(std::string{"a"});
+    EXPECT_EQ(pushes, 1);
+
+    p.update_value(std::string{"b"});
+    EXPECT_EQ(pushes, 2);
+
+    // a quiet update is never pushed, the next equal value must be
+    p.update_value_quiet(std::string{"c"});
+    p.update_value(std::string{"c"});
+    EXPECT_EQ(pushes, 3);
+
+    p.set_distinct(false);
+    p.update_value(std::string{"c"});
+    EXPECT_EQ(pushes, 4);
+}
+
+TEST(PropagationTest, ProfilingCounters) {
+    manager mgr{manager_no_async};
+    auto& p = mgr.add_node<provider_cached<int>>();
+    auto& trans = mgr.add_node(make_transformer([](int v){ return v + 1; }));
+    auto& term = mgr.add_node<terminal_cached<int>>();
+
+    p.connect_successor(trans);
+    trans.connect_successor(term);
+    trans.set_profile_name("plus_one");
+
+    p.update_value(1);
+    p.update_value(2);
+    EXPECT_EQ(term.request_cache(), 3);
+
+    const manager_stats stats = mgr.stats();
+    if constexpr (!profiling_enabled) {
+        EXPECT_TRUE(stats.nodes.empty());
+        EXPECT_TRUE(trans.get_profile_name().empty());
+        return;
+    }
+
+    const auto itr = std::ranges::find(stats.nodes, &trans, &node_stats::owner);
+    ASSERT_NE(itr, stats.nodes.end());
+    EXPECT_EQ(itr->name, "plus_one");
+    EXPECT_EQ(itr->profile.recomputations, 2u);
+    EXPECT_EQ(itr->profile.pushes, 2u);
+    EXPECT_GE(itr->profile.total_time, itr->profile.self_time);
+
+    mgr.reset_stats();
+    EXPECT_EQ(trans.get_profile().recomputations, 0u);
+}
+
+TEST(PropagationTest, ChromeTraceExport) {
+    manager mgr{manager_no_async};
+    auto& p = mgr.add_node<provider_cached<int>>();
+    auto& trans = mgr.add_node(make_transformer([](int v){ return v * 2; }));
+    p.connect_successor(trans);
+    trans.set_profile_name("double \"it\"");
+
+    manager::begin_trace();
+    p.update_value(21);
+    manager::end_trace();
+
+    std::ostringstream stream;
+    mgr.export_chrome_trace(stream);
+    const std::string json = stream.str();
+
+    EXPECT_TRUE(json.starts_with(R"({"traceEvents":[)"));
+    EXPECT_TRUE(json.ends_with("}"));
+    if constexpr (profiling_enabled) {
+        EXPECT_NE(json.find(R"("name":"double \"it\"")"), std::string::npos);
+        EXPECT_NE(json.find(R"("ph":"X")"), std::string::npos);
+    } else {
+        EXPECT_EQ(json.find(R"("ph")"), std::string::npos);
+    }
+}
+
+TEST(PropagationTest, PulseGroupsTickIndependently) {
+    manager mgr{manager_no_async};
+    auto& slow = mgr.add_pulse_group("stats", std::chrono::hours{1});
+    EXPECT_EQ(mgr.find_pulse_group("stats"), &slow);
+    EXPECT_EQ(&mgr.add_pulse_group("stats", std::chrono::hours{1}), &slow);
+
+    auto& fast_src = mgr.add_node<provider_cached<int>>(propagate_type::pulse);
+    auto& slow_src = mgr.add_node<provider_cached<int>>(propagate_type::pulse);
+    slow_src.set_pulse_group(slow);
+    EXPECT_EQ(fast_src.get_pulse_group(), &mgr.get_default_pulse_group());
+
+    int fast_value = 0;
+    int slow_value = 0;
+    auto& fast_listener = mgr.add_node(make_listener([&](int v){ fast_value = v; }));
+    auto& slow_listener = mgr.add_node(make_listener([&](int v){ slow_value = v; }));
+    fast_src.connect_successor(fast_listener);
+    slow_src.connect_successor(slow_listener);
+
+    // The first update ticks every group
+    fast_src.update_value(1);
+    slow_src.update_value(1);
+    mgr.update();
+    EXPECT_EQ(fast_value, 1);
+    EXPECT_EQ(slow_value, 1);
+
+    // Within the period only the default group ticks, the slow node keeps its pending data
+    fast_src.update_value(2);
+    slow_src.update_value(2);
+    mgr.update();
+    EXPECT_EQ(fast_value, 2);
+    EXPECT_EQ(slow_value, 1);
+    EXPECT_EQ(slow.get_pending_count(), 1u);
+
+    mgr.pulse(slow);
+    EXPECT_EQ(slow_value, 2);
+    EXPECT_EQ(slow.get_pending_count(), 0u);
+}
+
+TEST(PropagationTest, PulseTickVisitsOnlyPendingNodes) {
+    manager mgr{manager_no_async};
+
+    std::vector<provider_cached<int>*> sources;
+    for (int i = 0; i < 100; ++i) {
+        sources.push_back(&mgr.add_node<provider_cached<int>>(propagate_type::pulse));
+    }
+
+    // A chain of pulse nodes settles in a single tick
+    auto& doubled = mgr.add_node(make_transformer(propagate_type::pulse, [](int v){ return v * 2; }));
+    auto& term = mgr.add_node<terminal_cached<int>>(propagate_type::pulse);
+    sources[42]->connect_successor(doubled);
+    doubled.connect_successor(term);
+
+    auto& group = mgr.get_default_pulse_group();
+    EXPECT_EQ(group.get_pending_count(), 0u);
+
+    sources[42]->update_value(21);
+    sources[42]->update_value(22);
+    EXPECT_EQ(group.get_pending_count(), 1u);
+
+    mgr.update();
+    EXPECT_EQ(group.get_pending_count(), 0u);
+    EXPECT_EQ(term.request_cache(), 44);
+}
+
+TEST(PropagationTest, BatchTransformerRunsElementwise) {
+    manager mgr{manager_no_async};
+    auto& scale = mgr.add_node<provider_general<value_batch<float>>>();
+    auto& offset = mgr.add_node<provider_cached<value_batch<float>>>();
+
+    auto& mul = mgr.add_node(make_batch_transformer([](float v) { return v * 2.f; }));
+    auto& add = mgr.add_node(make_batch_transformer([](float a, float b) { return a + b; }));
+
+    std::vector<float> received;
+    auto& listener = mgr.add_node(make_batch_listener([&](std::span<const float> values) {
+        received.assign(values.begin(), values.end());
+    }));
+
+    offset.update_value(value_batch<float>{10.f, 20.f, 30.f, 40.f});
+    scale.connect_successor(mul);
+    mul.connect_successor(0, add);
+    offset.connect_successor(1, add);
+    add.connect_successor(listener);
+
+    scale.update_value(value_batch<float>{1.f, 2.f, 3.f});
+    // The shortest input bounds the chunk
+    EXPECT_EQ(received, (std::vector<float>{12.f, 24.f, 36.f}));
+
+    const float* buffer = mul.get_buffer().data();
+    scale.update_value(value_batch<float>{4.f, 5.f});
+    EXPECT_EQ(received, (std::vector<float>{18.f, 30.f}));
+    // The output chunk keeps its storage
+    EXPECT_EQ(mul.get_buffer().data(), buffer);
+}
+
+TEST(PropagationTest, BatchUnpackerFeedsScalarNodes) {
+    manager mgr{manager_no_async};
+    auto& source = mgr.add_node<provider_general<value_batch<int>>>();
+    auto& scalar = mgr.add_node(make_transformer([](int v) { return v + 1; }));
+
+    std::vector<int> received;
+    auto& listener = mgr.add_node(make_listener([&](int v) {
+        received.push_back(v);
+    }));
+    scalar.connect_successor(listener);
+
+    auto& unpacker = connect_unbatched(mgr, source, scalar);
+    source.update_value(value_batch<int>{1, 2, 3});
+    EXPECT_EQ(received, (std::vector<int>{2, 3, 4}));
+
+    source.update_value(value_batch<int>{});
+    EXPECT_EQ(received.size(), 3u);
+
+    unpacker.disconnect_self_from_context();
+    source.update_value(value_batch<int>{5});
+    EXPECT_EQ(received.size(), 3u);
+}
+
+TEST(PropagationTest, SeriesStagesProcessOnlyAppendedTail) {
+    manager mgr{manager_no_async};
+    auto& source = mgr.add_node<series_source<double>>();
+
+    int mapped = 0;
+    auto& norm = mgr.add_node(make_series_map([&](double v) { ++mapped; return v * 2.0; }));
+    auto& ema = mgr.add_node(make_series_ema(0.5));
+    auto& sum = mgr.add_node(make_series_reduce(0.0, [](double acc, double v) { return acc + v; }));
+
+    std::vector<double> ema_values;
+    double total = 0.0;
+    auto& ema_listener = mgr.add_node(make_listener([&](const series_delta<double>& delta) {
+        if(delta.reset) ema_values.resize(delta.offset);
+        ema_values.insert(ema_values.end(), delta.tail.begin(), delta.tail.end());
+    }));
+    auto& sum_listener = mgr.add_node(make_listener([&](double v) { total = v; }));
+
+    source.connect_successor(norm);
+    norm.connect_successor(ema);
+    norm.connect_successor(sum);
+    ema.connect_successor(ema_listener);
+    sum.connect_successor(sum_listener);
+
+    source.append(std::vector{1.0, 3.0});
+    EXPECT_EQ(ema_values, (std::vector{2.0, 4.0}));
+    EXPECT_DOUBLE_EQ(total, 8.0);
+
+    source.append(5.0);
+    // Only the new sample is mapped, the EMA and the sum continue from their state
+    EXPECT_EQ(mapped, 3);
+    EXPECT_EQ(ema_values, (std::vector{2.0, 4.0, 7.0}));
+    EXPECT_DOUBLE_EQ(total, 18.0);
+    EXPECT_EQ(sum.get_consumed_length(), 3u);
+
+    // The same delta observed again is not folded twice
+    ASSERT_TRUE(sum.request_raw(false).has_value());
+    EXPECT_DOUBLE_EQ(sum.get_buffer(), 18.0);
+    EXPECT_EQ(mapped, 3);
+
+    source.reset(std::vector{4.0});
+    EXPECT_EQ(ema_values, (std::vector{8.0}));
+    EXPECT_DOUBLE_EQ(total, 8.0);
+    EXPECT_EQ(source.get_length(), 1u);
+}
+
+TEST(PropagationTest, PatchMapRecomputesOnlyChangedElements) {
+    manager mgr{manager_no_async};
+    auto& source = mgr.add_node<patch_source<std::vector<int>>>();
+
+    int calls = 0;
+    auto& squares = mgr.add_node(make_patch_map<std::vector<int>>([&](int v) { ++calls; return v * v; }));
+
+    std::vector<int> plain;
+    auto& unaware = mgr.add_node(make_listener([&](const std::vector<int>& v) { plain = v; }));
+    source.connect_successor(squares);
+    connect_unpatched(mgr, squares, unaware);
+
+    source.assign(std::vector{1, 2, 3, 4});
+    EXPECT_EQ(plain, (std::vector{1, 4, 9, 16}));
+    EXPECT_EQ(calls, 4);
+
+    source.set(2, 5);
+    EXPECT_EQ(plain, (std::vector{1, 4, 25, 16}));
+    EXPECT_EQ(calls, 5);
+
+    source.modify([](std::vector<int>& v) {
+        v.erase(v.begin());
+        v.insert(v.begin() + 1, {6, 7});
+    }, {{patch_kind::erase, 0}, {patch_kind::insert, 1, 2}});
+    EXPECT_EQ(plain, (std::vector{4, 36, 49, 25, 16}));
+    EXPECT_EQ(calls, 7);
+    EXPECT_EQ(squares.get_rebuild_count(), 1u);
+    EXPECT_EQ(squares.get_buffer().get_patch().size(), 2u);
+}
+
+TEST(PropagationTest, PatchTransformerFallsBackToRebuild) {
+    manager mgr{manager_no_async};
+    auto& source = mgr.add_node<patch_source<std::map<std::string, int>>>();
+
+    // Per key mirror of the summed values, the patch only adjusts the sum by the changed keys
+    std::map<std::string, int> mirror;
+    std::vector<patch_entry<std::string>> applied;
+
+    auto& total = mgr.add_node(make_patch_transformer(
+        [&](long long& sum, const std::map<std::string, int>& value) {
+            mirror = value;
+            sum = 0;
+            for (const auto& [key, v] : value) sum += v;
+        },
+        [&](long long& sum, const std::map<std::string, int>& value, std::span<const patch_entry<std::string>> patch) {
+            for (const auto& entry : patch) {
+                applied.push_back(entry);
+                if (const auto itr = mirror.find(entry.key); itr != mirror.end()) {
+                    sum -= itr->second;
+                    mirror.erase(itr);
+                }
+                if (const auto itr = value.find(entry.key); itr != value.end()) {
+                    sum += itr->second;
+                    mirror.emplace(entry.key, itr->second);
+                }
+            }
+        }));
+
+    long long received = 0;
+    auto& listener = mgr.add_node(make_listener([&](long long v) { received = v; }));
+    total.connect_successor(listener);
+
+    source.insert_or_assign("a", 1);
+    // Not connected yet: the next patch does not continue a seen version
+    source.connect_successor(total);
+    source.insert_or_assign("b", 2);
+    EXPECT_EQ(received, 3);
+    EXPECT_EQ(total.get_rebuild_count(), 1u);
+    EXPECT_TRUE(applied.empty());
+
+    source.erase("a");
+    EXPECT_EQ(received, 2);
+    EXPECT_EQ(total.get_rebuild_count(), 1u);
+    EXPECT_EQ(applied, (std::vector<patch_entry<std::string>>{{patch_kind::erase, "a"}}));
+
+    source.insert_or_assign("b", 5);
+    source.insert_or_assign("d", 4);
+    EXPECT_EQ(received, 9);
+    EXPECT_EQ(total.get_rebuild_count(), 1u);
+    ASSERT_EQ(applied.size(), 3u);
+    EXPECT_EQ(applied[1], (patch_entry<std::string>{patch_kind::update, "b"}));
+    EXPECT_EQ(applied[2], (patch_entry<std::string>{patch_kind::insert, "d"}));
+    EXPECT_EQ(mirror, (std::map<std::string, int>{{"b", 5}, {"d", 4}}));
+
+    source.assign({{"c", 10}});
+    EXPECT_EQ(received, 10);
+    EXPECT_EQ(total.get_rebuild_count(), 2u);
+    EXPECT_EQ(applied.size(), 3u);
+}
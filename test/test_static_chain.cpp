@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+import mo_yanxi.react_flow;
+import mo_yanxi.react_flow.common;
+import std;
+
+using namespace mo_yanxi::react_flow;
+
+namespace {
+auto make_parse_stage() {
+    return make_transformer<descriptor<std::string, {true}, std::string_view>>([](std::string_view input) -> std::optional<int> {
+        int v;
+        if(const auto [ptr, ec] = std::from_chars(input.data(), input.data() + input.size(), v); ec == std::errc{}) {
+            return v;
+        }
+        return std::nullopt;
+    });
+}
+}
+
+TEST(StaticChainTest, FusedStagesMatchNodeChain) {
+    manager mgr;
+    auto& p = mgr.add_node<provider_general<std::string>>();
+
+    auto& chain = mgr.add_node(make_static_chain(
+        make_parse_stage(),
+        make_transformer([](std::optional<int>&& v) -> std::optional<int> {
+            return v.transform([](int x){ return x * 2; });
+        }),
+        make_transformer([](std::optional<int> v) {
+            return v.value_or(-1);
+        })));
+
+    int received = 0;
+    auto& l = mgr.add_node(make_listener([&](int v){ received = v; }));
+
+    connect_chain({&p, &chain, &l});
+
+    p.update_value(std::string{"21"});
+    EXPECT_EQ(received, 42);
+
+    p.update_value(std::string{"not a number"});
+    EXPECT_EQ(received, -1);
+
+    p.update_value(std::string{"100"});
+    EXPECT_EQ(received, 200);
+}
+
+TEST(StaticChainTest, LazyFetchThroughChain) {
+    manager mgr;
+    auto& p = mgr.add_node<provider_cached<int>>();
+
+    int first_count = 0;
+    int second_count = 0;
+    auto& chain = mgr.add_node(make_static_chain(propagate_type::lazy,
+        make_transformer([&](int v){ ++first_count; return v + 1; }),
+        make_transformer([&](int v){ ++second_count; return v * 10; })));
+
+    auto& term = mgr.add_node<terminal_cached<int>>(propagate_type::lazy);
+
+    p.connect_successor(chain);
+    chain.connect_successor(term);
+
+    p.update_value(4);
+    EXPECT_EQ(first_count, 0);
+    EXPECT_EQ(term.request_cache(), 50);
+    EXPECT_EQ(first_count, 1);
+    EXPECT_EQ(second_count, 1);
+}
+
+TEST(StaticChainTest, MultiInputHeadInDynamicGraph) {
+    manager mgr;
+    auto& a = mgr.add_node<provider_cached<int>>();
+    auto& b = mgr.add_node<provider_cached<int>>();
+
+    auto& chain = mgr.add_node(make_static_chain(
+        make_transformer([](int x, int y){ return x + y; }),
+        make_transformer([](int v){ return std::to_string(v); })));
+
+    auto& suffix = mgr.add_node(make_transformer([](const std::string& s){ return s + "!"; }));
+
+    std::string received;
+    auto& l = mgr.add_node(make_listener([&](std::string s){ received = std::move(s); }));
+
+    a.connect_successor(0, chain);
+    b.connect_successor(1, chain);
+    chain.connect_successor(suffix);
+    suffix.connect_successor(l);
+
+    a.update_value(1);
+    b.update_value(2);
+    EXPECT_EQ(received, "3!");
+}